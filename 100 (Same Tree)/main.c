@@ -2,50 +2,55 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
-// Definition for a binary tree node.
-struct TreeNode {
-    int val;                    // Stores the value of the node
-    struct TreeNode *left;       // Pointer to the left child node
-    struct TreeNode *right;      // Pointer to the right child node
-};
-
-// Preorder traversal function to compare two trees
-void pre_order(struct TreeNode* p, struct TreeNode* q, int *flag) {
-    // If both nodes are NULL, return (they are identical at this point)
-    if ((p == NULL) && (q == NULL))
-        return;
-
-    // If one is NULL and the other is not, trees are not identical
-    if ((p == NULL) && (q != NULL)) {
-        (*flag) = 0;
-        return;
-    }
-    if ((q == NULL) && (p != NULL)) {
-        (*flag) = 0;
-        return;
-    }
-
-    // If values of the current nodes do not match, trees are not identical
-    if (p->val != q->val)
-        (*flag) = 0;
-
-    // Recursively check left subtrees
-    pre_order(p->left, q->left, flag);
-    // Recursively check right subtrees
-    pre_order(p->right, q->right, flag);
-
-    return;
-}
-
-// Function to check if two binary trees are the same
+// Definition for a binary tree node (val, left, right).
+#include "../TREES/TreeNode.h"
+
+// Function to check if two binary trees are the same.
+// Walks both trees together in preorder with an explicit stack of node
+// pairs and returns at the first difference, so a mismatch near the root
+// costs almost nothing and deep trees cannot overflow the call stack.
+// Subtrees shared by both trees (same pointer) are skipped.
+// For repeated comparisons of the same trees, TREES/TreePool.h caches a
+// hash per subtree (treePoolSameSubtree) and rejects most unequal pairs
+// without walking them.
 bool isSameTree(struct TreeNode* p, struct TreeNode* q) {
-    int flag = 1; // Assume trees are identical initially
-    pre_order(p, q, &flag); // Call preorder traversal to compare trees
+    struct TreeNode* local[2 * 64];
+    struct TreeNode** stack = local;
+    int capacity = 64, top = 0;
+    bool same = true;
+
+    stack[top++] = p;
+    stack[top++] = q;
+    while (top > 0) {
+        struct TreeNode* b = stack[--top];
+        struct TreeNode* a = stack[--top];
+        // Both NULL, or the very same subtree
+        if (a == b)
+            continue;
+        // One is NULL, or the values differ: trees are not identical
+        if (a == NULL || b == NULL || a->val != b->val) {
+            same = false;
+            break;
+        }
+
+        // Grow the stack on the heap when the trees are deep
+        if (top + 4 > 2 * capacity) {
+            capacity *= 2;
+            struct TreeNode** grown = (struct TreeNode**)malloc(2 * capacity * sizeof(struct TreeNode*));
+            for (int i = 0; i < top; i++)
+                grown[i] = stack[i];
+            if (stack != local)
+                free(stack);
+            stack = grown;
+        }
+        // Right pair first so the left subtrees are compared first
+        stack[top++] = a->right;
+        stack[top++] = b->right;
+        stack[top++] = a->left;
+        stack[top++] = b->left;
+    }
 
-    // If flag is set to 0, trees are not identical
-    if (flag == 0)
-        return false;
-    else
-        return true;
+    if (stack != local)
+        free(stack);
+    return same;
 }
-
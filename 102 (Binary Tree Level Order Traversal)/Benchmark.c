@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+
+/*
+   levelOrderArena and levelOrder against the fixed-array levelOrder, on
+   complete and right-skewed trees, counting calls to malloc and realloc.
+
+   Build:  gcc -O2 Benchmark.c -o bench
+   Run:    ./bench [nodes]
+
+   The old code holds at most 2000 queued nodes and 2000 levels, so it
+   only runs on the 2000-node trees; the new code also runs on trees of
+   `nodes` (default 10^7) nodes, with a fresh arena and with one reused
+   from the previous call. levelOrder keeps LeetCode's per-row result,
+   which is freed row by row.
+*/
+
+static long mallocCalls = 0;
+
+static void* countedMalloc(size_t size) {
+    mallocCalls++;
+    return malloc(size);
+}
+
+static void* countedRealloc(void* p, size_t size) {
+    mallocCalls++;
+    return realloc(p, size);
+}
+
+#define malloc countedMalloc
+#define realloc countedRealloc
+
+#include "OptimizedVersionCode.c"
+
+#define TreeNode TreeNodeFixed
+#define levelOrder levelOrderFixed
+#include "OptimizedVersionCode (fixed arrays).c"
+#undef TreeNode
+#undef levelOrder
+
+#undef malloc
+#undef realloc
+
+static struct TreeNode* buildTree(int n, int skewed) {
+    struct TreeNode* nodes = (struct TreeNode*)malloc(n * sizeof(struct TreeNode));
+    for (int i = 0; i < n; i++) {
+        nodes[i].val = i;
+        if (skewed) {
+            nodes[i].left = NULL;
+            nodes[i].right = (i + 1 < n) ? &nodes[i + 1] : NULL;
+        } else {
+            nodes[i].left = (2 * i + 1 < n) ? &nodes[2 * i + 1] : NULL;
+            nodes[i].right = (2 * i + 2 < n) ? &nodes[2 * i + 2] : NULL;
+        }
+    }
+    return nodes;
+}
+
+/* Values must come out 0, 1, 2, ... for both shapes. */
+static int checkLevels(int** rows, int levels, const int* sizes, int n) {
+    int next = 0;
+    for (int l = 0; l < levels; l++) {
+        for (int j = 0; j < sizes[l]; j++) {
+            if (rows[l][j] != next++) return 1;
+        }
+    }
+    return next != n;
+}
+
+static void run(const char* name, int n, int skewed, LevelArena* warm) {
+    struct TreeNode* root = buildTree(n, skewed);
+    int levels, *sizes, bad = 0;
+
+    if (n <= 2000) {
+        mallocCalls = 0;
+        double t0 = nowSeconds();
+        int** rows = levelOrderFixed((struct TreeNodeFixed*)root, &levels, &sizes);
+        double t = nowSeconds() - t0;
+        bad = checkLevels(rows, levels, sizes, n);
+        printf("%-9s %9d %-12s %10.3f %10ld%s\n", name, n, "fixed", t * 1e3, mallocCalls,
+               bad ? "  (MISMATCH)" : "");
+        for (int l = 0; l < levels; l++) free(rows[l]);
+        free(rows);
+        free(sizes);
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        mallocCalls = 0;
+        double t0 = nowSeconds();
+        int** rows = levelOrderArena(root, &levels, &sizes, pass ? warm : NULL);
+        double t = nowSeconds() - t0;
+        bad = checkLevels(rows, levels, sizes, n);
+        printf("%-9s %9d %-12s %10.3f %10ld%s\n", name, n, pass ? "arena, warm" : "arena, cold",
+               t * 1e3, mallocCalls, bad ? "  (MISMATCH)" : "");
+        free(rows);
+    }
+
+    mallocCalls = 0;
+    double t0 = nowSeconds();
+    int** rows = levelOrder(root, &levels, &sizes);
+    double t = nowSeconds() - t0;
+    bad = checkLevels(rows, levels, sizes, n);
+    printf("%-9s %9d %-12s %10.3f %10ld%s\n", name, n, "per-row", t * 1e3, mallocCalls,
+           bad ? "  (MISMATCH)" : "");
+    for (int l = 0; l < levels; l++) free(rows[l]);
+    free(rows);
+    free(sizes);
+    free(root);
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    LevelArena warm;
+    levelArenaInit(&warm);
+
+    printf("%-9s %9s %-12s %10s %10s\n", "shape", "nodes", "version", "ms", "mallocs");
+    int sizes[2] = { 2000, n };
+    for (int s = 0; s < 2; s++) {
+        // Warm the arena on the tree first so the second pass reuses it.
+        for (int skewed = 0; skewed < 2; skewed++) {
+            struct TreeNode* root = buildTree(sizes[s], skewed);
+            int levels, *columns;
+            free(levelOrderArena(root, &levels, &columns, &warm));
+            free(root);
+            run(skewed ? "skewed" : "complete", sizes[s], skewed, &warm);
+        }
+    }
+
+    levelArenaFree(&warm);
+    return 0;
+}
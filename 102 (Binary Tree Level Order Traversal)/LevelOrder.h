@@ -0,0 +1,39 @@
+#ifndef LEVEL_ORDER_H
+#define LEVEL_ORDER_H
+
+struct TreeNode;
+
+/*
+   Scratch memory for levelOrder: the BFS ring buffer and staging arrays
+   for values and level offsets. All of it grows geometrically and is
+   kept between calls, so a reused arena stops allocating once it has
+   seen the largest tree.
+*/
+typedef struct {
+    struct TreeNode** ring;     // power-of-two capacity
+    int ringCapacity;
+    int* values;
+    int valuesCapacity;
+    int* start;                 // start[l] = index of the first value of level l
+    int startCapacity;
+} LevelArena;
+
+void levelArenaInit(LevelArena* arena);
+void levelArenaFree(LevelArena* arena);
+
+/*
+   Same result shape as LeetCode's levelOrder, but rows, column sizes and
+   values live in one allocation: the row pointers come first, then the
+   column sizes (*returnColumnSizes points there), then every value in
+   level order. free(result) releases all of it; do not free the rows or
+   the column sizes separately. arena may be NULL.
+*/
+int** levelOrderArena(struct TreeNode* root, int* returnSize, int** returnColumnSizes,
+                      LevelArena* arena);
+
+/* LeetCode's levelOrder: the same BFS with a temporary arena, but every
+   row, the column sizes and the row array are separate allocations that
+   the caller frees one by one. */
+int** levelOrder(struct TreeNode* root, int* returnSize, int** returnColumnSizes);
+
+#endif
@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+
+struct TreeNode {
+    int val ;
+    struct TreeNode * left ;
+    struct TreeNode * right ;
+};
+
+
+
+
+int** levelOrder(struct TreeNode* root, int* returnSize, int** returnColumnSizes) {
+    *returnSize = 0;
+    if (!root) {
+        *returnColumnSizes = NULL;
+        return NULL;
+    }
+
+    int** result = (int**)malloc(2000 * sizeof(int*));
+    *returnColumnSizes = (int*)malloc(2000 * sizeof(int));
+
+    struct TreeNode* queue[2000];
+    int front = 0, rear = 0;
+    queue[rear++] = root;
+
+    while (front < rear) {
+        int levelSize = rear - front;
+        result[*returnSize] = (int*)malloc(levelSize * sizeof(int));
+        (*returnColumnSizes)[*returnSize] = levelSize;
+
+        for (int i = 0; i < levelSize; i++) {
+            struct TreeNode* node = queue[front++];
+            result[*returnSize][i] = node->val;
+            if (node->left) queue[rear++] = node->left;
+            if (node->right) queue[rear++] = node->right;
+        }
+
+        (*returnSize)++;
+    }
+
+    return result;
+}
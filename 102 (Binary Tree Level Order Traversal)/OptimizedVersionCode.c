@@ -1,44 +1,127 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "../TREES/TreeNode.h"
+#include "LevelOrder.h"
 
 
-struct TreeNode {
-    int val ;
-    struct TreeNode * left ;
-    struct Treenode * right ;
-};
+void levelArenaInit(LevelArena* arena) {
+    memset(arena, 0, sizeof(LevelArena));
+}
 
+void levelArenaFree(LevelArena* arena) {
+    free(arena->ring);
+    free(arena->values);
+    free(arena->start);
+    levelArenaInit(arena);
+}
 
+static void reserveInts(int** data, int* capacity, int need) {
+    if (need <= *capacity) return;
+    int grown = *capacity ? *capacity : 64;
+    while (grown < need) grown *= 2;
+    *data = (int*)realloc(*data, grown * sizeof(int));
+    *capacity = grown;
+}
 
+/* Doubles the ring, moving the count queued entries from head to the front. */
+static void growRing(LevelArena* a, int head, int count) {
+    int capacity = a->ringCapacity ? a->ringCapacity * 2 : 64;
+    struct TreeNode** ring = (struct TreeNode**)malloc(capacity * sizeof(struct TreeNode*));
+    for (int i = 0; i < count; i++) ring[i] = a->ring[(head + i) & (a->ringCapacity - 1)];
+    free(a->ring);
+    a->ring = ring;
+    a->ringCapacity = capacity;
+}
 
-int** levelOrder(struct TreeNode* root, int* returnSize, int** returnColumnSizes) {
+/* Runs the BFS into the arena: values in level order, start[l] = index of
+   the first value of level l and start[levels] = number of values.
+   Returns the number of levels. */
+static int stageLevels(struct TreeNode* root, LevelArena* a) {
+    if (a->ringCapacity == 0) growRing(a, 0, 0);
+    int mask = a->ringCapacity - 1;
+    int head = 0, count = 0, levels = 0, n = 0;
+    a->ring[count++] = root;
+
+    while (count > 0) {
+        int levelSize = count;
+        reserveInts(&a->start, &a->startCapacity, levels + 2);
+        reserveInts(&a->values, &a->valuesCapacity, n + levelSize);
+        a->start[levels++] = n;
+
+        for (int i = 0; i < levelSize; i++) {
+            struct TreeNode* node = a->ring[head];
+            head = (head + 1) & mask;
+            count--;
+            a->values[n++] = node->val;
+            if (count + 2 > a->ringCapacity) {
+                growRing(a, head, count);
+                head = 0;
+                mask = a->ringCapacity - 1;
+            }
+            if (node->left) a->ring[(head + count++) & mask] = node->left;
+            if (node->right) a->ring[(head + count++) & mask] = node->right;
+        }
+    }
+    a->start[levels] = n;
+    return levels;
+}
+
+int** levelOrderArena(struct TreeNode* root, int* returnSize, int** returnColumnSizes,
+                      LevelArena* arena) {
     *returnSize = 0;
     if (!root) {
         *returnColumnSizes = NULL;
         return NULL;
     }
+    LevelArena local;
+    LevelArena* a = arena;
+    if (a == NULL) {
+        levelArenaInit(&local);
+        a = &local;
+    }
+    int levels = stageLevels(root, a);
+    int n = a->start[levels];
 
-    int** result = (int**)malloc(2000 * sizeof(int*));
-    *returnColumnSizes = (int*)malloc(2000 * sizeof(int));
-
-    struct TreeNode* queue[2000];
-    int front = 0, rear = 0;
-    queue[rear++] = root;
+    // One block: row pointers, column sizes, values.
+    char* block = (char*)malloc(levels * sizeof(int*) + ((size_t)levels + n) * sizeof(int));
+    int** result = (int**)block;
+    int* columnSizes = (int*)(block + levels * sizeof(int*));
+    int* values = columnSizes + levels;
+    memcpy(values, a->values, n * sizeof(int));
+    for (int l = 0; l < levels; l++) {
+        result[l] = values + a->start[l];
+        columnSizes[l] = a->start[l + 1] - a->start[l];
+    }
 
-    while (front < rear) {
-        int levelSize = rear - front;
-        result[*returnSize] = (int*)malloc(levelSize * sizeof(int));
-        (*returnColumnSizes)[*returnSize] = levelSize;
+    if (a == &local) levelArenaFree(&local);
+    *returnSize = levels;
+    *returnColumnSizes = columnSizes;
+    return result;
+}
 
-        for (int i = 0; i < levelSize; i++) {
-            struct TreeNode* node = queue[front++];
-            result[*returnSize][i] = node->val;
-            if (node->left) queue[rear++] = node->left;
-            if (node->right) queue[rear++] = node->right;
-        }
+int** levelOrder(struct TreeNode* root, int* returnSize, int** returnColumnSizes) {
+    *returnSize = 0;
+    if (!root) {
+        *returnColumnSizes = NULL;
+        return NULL;
+    }
+    LevelArena a;
+    levelArenaInit(&a);
+    int levels = stageLevels(root, &a);
 
-        (*returnSize)++;
+    // LeetCode's contract: the caller frees every row, the column sizes
+    // and the row array separately.
+    int** result = (int**)malloc(levels * sizeof(int*));
+    int* columnSizes = (int*)malloc(levels * sizeof(int));
+    for (int l = 0; l < levels; l++) {
+        columnSizes[l] = a.start[l + 1] - a.start[l];
+        result[l] = (int*)malloc(columnSizes[l] * sizeof(int));
+        memcpy(result[l], a.values + a.start[l], columnSizes[l] * sizeof(int));
     }
 
+    levelArenaFree(&a);
+    *returnSize = levels;
+    *returnColumnSizes = columnSizes;
     return result;
 }
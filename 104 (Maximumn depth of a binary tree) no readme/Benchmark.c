@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../BENCH/BenchUtil.h"
+#include "DepthPool.h"
+
+#define main mainExample
+#include "main.c"
+#undef main
+
+/*
+   maxDepth variants on balanced, random and fully skewed trees of 10^5
+   to 10^8 nodes.
+
+   Build:  gcc -O2 -pthread Benchmark.c DepthPool.c ../TREES/TreePool.c -o bench
+   Run:    ./bench [maxNodes] [threads]
+
+   "recursive" is the original maxDepth; it is skipped once the tree is
+   deeper than RECURSION_LIMIT, where it would overflow the call stack.
+   "iterative" is maxDepthHint with the node count as hint, "pool" is
+   depthPoolMaxDepth on a pool created once. Random trees have the shape
+   of a random binary search tree. Nodes sit in one array in preorder;
+   10^8 nodes take 2.4 GB.
+*/
+
+#define RECURSION_LIMIT 100000
+
+static int recursiveDepth(struct TreeNode* root) {
+    if (root == NULL) return 0;
+    int l = recursiveDepth(root->left);
+    int r = recursiveDepth(root->right);
+    return (l > r) ? (l + 1) : (r + 1);
+}
+
+typedef struct {
+    int first;      // index of the subtree root in nodes[]
+    int size;
+    int depth;
+} Span;
+
+/*
+   Lays out a tree of n nodes in preorder: the subtree at `first` of
+   `size` nodes has its left subtree right after it. shape 0 splits evenly,
+   1 at a uniformly random point, 2 never (every node has only a right
+   child). Returns the depth.
+*/
+static int buildTree(struct TreeNode* nodes, int n, int shape) {
+    Span* stack = (Span*)malloc(64 * sizeof(Span));
+    int capacity = 64, top = 0, depth = 0;
+    stack[top++] = (Span){ 0, n, 1 };
+    while (top > 0) {
+        Span s = stack[--top];
+        if (s.depth > depth) depth = s.depth;
+        int rest = s.size - 1, leftSize;
+        if (shape == 0) leftSize = rest / 2;
+        else if (shape == 1) leftSize = rest ? (int)(((long long)rand() * RAND_MAX + rand()) % (rest + 1)) : 0;
+        else leftSize = 0;
+        int rightSize = rest - leftSize;
+
+        struct TreeNode* node = &nodes[s.first];
+        node->val = s.first;
+        node->left = leftSize ? &nodes[s.first + 1] : NULL;
+        node->right = rightSize ? &nodes[s.first + 1 + leftSize] : NULL;
+        if (top + 2 > capacity) {
+            capacity *= 2;
+            stack = (Span*)realloc(stack, capacity * sizeof(Span));
+        }
+        if (rightSize) stack[top++] = (Span){ s.first + 1 + leftSize, rightSize, s.depth + 1 };
+        if (leftSize) stack[top++] = (Span){ s.first + 1, leftSize, s.depth + 1 };
+    }
+    free(stack);
+    return depth;
+}
+
+int main(int argc, char** argv) {
+    int maxNodes = (argc > 1) ? atoi(argv[1]) : 100000000;
+    int threads = (argc > 2) ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    struct TreeNode* nodes = (struct TreeNode*)malloc((size_t)maxNodes * sizeof(struct TreeNode));
+    DepthPool* pool = depthPoolCreate(threads);
+    const char* shapes[3] = { "balanced", "random", "skewed" };
+    srand(104);
+
+    printf("threads = %d\n", threads);
+    printf("%-9s %10s %10s %12s %12s %12s\n", "shape", "nodes", "depth", "recursive ms",
+           "iterative ms", "pool ms");
+    for (long long n = 100000; n <= maxNodes; n *= 10) {
+        for (int shape = 0; shape < 3; shape++) {
+            int depth = buildTree(nodes, (int)n, shape);
+            char recursive[32] = "-";
+            int bad = 0;
+            double t0;
+            if (depth <= RECURSION_LIMIT) {
+                t0 = nowSeconds();
+                bad |= recursiveDepth(nodes) != depth;
+                snprintf(recursive, sizeof(recursive), "%.2f", (nowSeconds() - t0) * 1e3);
+            }
+            t0 = nowSeconds();
+            bad |= maxDepthHint(nodes, (int)n) != depth;
+            double tIterative = nowSeconds() - t0;
+            t0 = nowSeconds();
+            bad |= depthPoolMaxDepth(pool, nodes, 0) != depth;
+            double tPool = nowSeconds() - t0;
+            printf("%-9s %10lld %10d %12s %12.2f %12.2f%s\n", shapes[shape], n, depth, recursive,
+                   tIterative * 1e3, tPool * 1e3, bad ? "  (MISMATCH)" : "");
+        }
+    }
+
+    depthPoolFree(pool);
+    free(nodes);
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include "DepthPool.h"
+
+typedef struct {
+    struct TreeNode* node;
+    int depth;
+} Frame;
+
+/* Shared deque of handed-off subtrees; the owner pushes at tail, thieves
+   take from head. */
+typedef struct {
+    pthread_mutex_t lock;
+    Frame* task;
+    int head, tail, capacity;
+} Deque;
+
+typedef struct {
+    DepthPool* pool;
+    int id;
+    pthread_t thread;
+    Deque deque;
+    Frame* stack;       // private: live frames are stack[base .. top)
+    int capacity;
+} Worker;
+
+struct DepthPool {
+    int threads;
+    Worker* workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t finished;
+    unsigned long long round;
+    int busy;
+    bool stop;
+
+    // The call being executed.
+    int cutoff;
+    atomic_int pending;     // tasks queued or running
+    atomic_int hungry;      // workers looking for a task
+    atomic_int best;
+};
+
+static void dequePush(Deque* d, Frame f) {
+    pthread_mutex_lock(&d->lock);
+    if (d->tail == d->capacity) {
+        // Slide live tasks to the front, then grow if still full.
+        int live = d->tail - d->head;
+        for (int i = 0; i < live; i++) d->task[i] = d->task[d->head + i];
+        d->head = 0;
+        d->tail = live;
+        if (d->tail == d->capacity) {
+            d->capacity *= 2;
+            d->task = (Frame*)realloc(d->task, d->capacity * sizeof(Frame));
+        }
+    }
+    d->task[d->tail++] = f;
+    pthread_mutex_unlock(&d->lock);
+}
+
+static bool dequeTake(Deque* d, Frame* f, bool fromHead) {
+    pthread_mutex_lock(&d->lock);
+    bool ok = d->head < d->tail;
+    if (ok) *f = fromHead ? d->task[d->head++] : d->task[--d->tail];
+    if (d->head == d->tail) d->head = d->tail = 0;
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+static void raiseBest(DepthPool* pool, int depth) {
+    int cur = atomic_load(&pool->best);
+    while (depth > cur && !atomic_compare_exchange_weak(&pool->best, &cur, depth)) { }
+}
+
+/* Same walk as maxDepthHint, plus hand-offs from the bottom of the stack. */
+static void runTask(Worker* w, Frame task) {
+    DepthPool* pool = w->pool;
+    int base = 0, top = 0, best = 0, sinceHandOff = 0;
+    w->stack[top++] = task;
+
+    while (top > base) {
+        Frame f = w->stack[--top];
+        for (struct TreeNode* node = f.node; node != NULL; node = node->left, f.depth++) {
+            if (f.depth > best) best = f.depth;
+            if (node->right) {
+                if (top == w->capacity) {
+                    if (base > 0) {
+                        // Reclaim the slots of handed-off frames first.
+                        memmove(w->stack, w->stack + base, (top - base) * sizeof(Frame));
+                        top -= base;
+                        base = 0;
+                    } else {
+                        w->capacity *= 2;
+                        w->stack = (Frame*)realloc(w->stack, w->capacity * sizeof(Frame));
+                    }
+                }
+                w->stack[top].node = node->right;
+                w->stack[top++].depth = f.depth + 1;
+            }
+            if (++sinceHandOff >= pool->cutoff) {
+                sinceHandOff = 0;
+                if (top - base >= 2 && atomic_load_explicit(&pool->hungry, memory_order_relaxed) > 0) {
+                    atomic_fetch_add(&pool->pending, 1);
+                    dequePush(&w->deque, w->stack[base++]);
+                }
+            }
+        }
+    }
+    raiseBest(pool, best);
+}
+
+static bool findTask(Worker* w, Frame* f) {
+    DepthPool* pool = w->pool;
+    if (dequeTake(&w->deque, f, false)) return true;
+    for (int k = 1; k < pool->threads; k++) {
+        if (dequeTake(&pool->workers[(w->id + k) % pool->threads].deque, f, true)) return true;
+    }
+    return false;
+}
+
+static void* workerMain(void* arg) {
+    Worker* w = (Worker*)arg;
+    DepthPool* pool = w->pool;
+    unsigned long long seen = 0;
+
+    while (true) {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->stop && pool->round == seen) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->round;
+        pthread_mutex_unlock(&pool->lock);
+
+        bool announced = false;
+        while (atomic_load(&pool->pending) > 0) {
+            Frame f;
+            if (findTask(w, &f)) {
+                if (announced) {
+                    atomic_fetch_sub(&pool->hungry, 1);
+                    announced = false;
+                }
+                runTask(w, f);
+                atomic_fetch_sub(&pool->pending, 1);
+            } else {
+                if (!announced) {
+                    atomic_fetch_add(&pool->hungry, 1);
+                    announced = true;
+                }
+                sched_yield();
+            }
+        }
+        if (announced) atomic_fetch_sub(&pool->hungry, 1);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busy == 0) pthread_cond_signal(&pool->finished);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+DepthPool* depthPoolCreate(int threads) {
+    DepthPool* pool = (DepthPool*)calloc(1, sizeof(DepthPool));
+    if (threads < 1) threads = 1;
+    pool->threads = threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->finished, NULL);
+
+    pool->workers = (Worker*)calloc(threads, sizeof(Worker));
+    for (int i = 0; i < threads; i++) {
+        Worker* w = &pool->workers[i];
+        w->pool = pool;
+        w->id = i;
+        w->capacity = 1024;
+        w->stack = (Frame*)malloc(w->capacity * sizeof(Frame));
+        pthread_mutex_init(&w->deque.lock, NULL);
+        w->deque.capacity = 64;
+        w->deque.task = (Frame*)malloc(w->deque.capacity * sizeof(Frame));
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&pool->workers[i].thread, NULL, workerMain, &pool->workers[i]);
+    }
+    return pool;
+}
+
+int depthPoolMaxDepth(DepthPool* pool, struct TreeNode* root, int cutoff) {
+    if (root == NULL) return 0;
+    pthread_mutex_lock(&pool->lock);
+    pool->cutoff = cutoff > 0 ? cutoff : DEPTH_POOL_CUTOFF;
+    atomic_store(&pool->best, 0);
+    atomic_store(&pool->hungry, 0);
+    atomic_store(&pool->pending, 1);
+    Frame f = { root, 1 };
+    dequePush(&pool->workers[0].deque, f);
+    pool->busy = pool->threads;
+    pool->round++;
+    pthread_cond_broadcast(&pool->start);
+    while (pool->busy > 0) {
+        pthread_cond_wait(&pool->finished, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return atomic_load(&pool->best);
+}
+
+void depthPoolFree(DepthPool* pool) {
+    if (pool == NULL) return;
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->threads; i++) {
+        Worker* w = &pool->workers[i];
+        pthread_join(w->thread, NULL);
+        pthread_mutex_destroy(&w->deque.lock);
+        free(w->deque.task);
+        free(w->stack);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->finished);
+    free(pool->workers);
+    free(pool);
+}
+
+int maxDepthParallel(struct TreeNode* root, int threads) {
+    DepthPool* pool = depthPoolCreate(threads);
+    int depth = depthPoolMaxDepth(pool, root, 0);
+    depthPoolFree(pool);
+    return depth;
+}
@@ -0,0 +1,34 @@
+#ifndef DEPTH_POOL_H
+#define DEPTH_POOL_H
+
+#include "../TREES/TreeNode.h"
+
+/*
+   Work-stealing pool for maxDepth on large trees.
+
+   Each worker walks its subtree depth-first with a private explicit
+   stack, like maxDepthHint in main.c. While some worker is idle, a busy
+   worker hands off the oldest frame on its stack (the pending subtree
+   closest to its task's root, so usually the largest) to its shared
+   deque, at most once per `cutoff` nodes it visits. Idle workers steal
+   from the other end of the other workers' deques. The cutoff bounds
+   the hand-off overhead to one locked push per `cutoff` nodes, and no
+   subtree sizes are needed up front.
+
+   The threads persist across calls, as in 3108/BatchQuery.c.
+*/
+
+typedef struct DepthPool DepthPool;
+
+DepthPool* depthPoolCreate(int threads);
+void depthPoolFree(DepthPool* pool);
+
+/* cutoff <= 0 picks DEPTH_POOL_CUTOFF. */
+int depthPoolMaxDepth(DepthPool* pool, struct TreeNode* root, int cutoff);
+
+#define DEPTH_POOL_CUTOFF 4096
+
+/* One-shot helper: creates a pool, runs, frees it. */
+int maxDepthParallel(struct TreeNode* root, int threads);
+
+#endif
@@ -1,38 +1,70 @@
+// Build:  gcc main.c ../TREES/TreePool.c -o main
+// The example in main() parses its tree with treeDeserialize, so this file
+// links only together with ../TREES/TreePool.c.
+
 #include <stdio.h>
 #include <stdlib.h>
+#include "../TREES/TreePool.h"
 
-struct TreeNode {
-    int val;
-    struct TreeNode *left;
-    struct TreeNode *right;
-};
+// Frames preallocated from the node-count hint before the stack has to grow.
+#define MAX_PREALLOCATED_FRAMES (1 << 16)
 
-int maxDepth(struct TreeNode* root) {
-    int l, r;
+typedef struct {
+    struct TreeNode* node;
+    int depth;
+} Frame;
+
+// Depth-first walk with an explicit stack, so a linked-list-shaped tree
+// of millions of nodes cannot overflow the call stack. The stack holds at
+// most one pending right child per level, so it never needs more frames
+// than there are nodes; nodeHint (0 if unknown) preallocates that many,
+// up to MAX_PREALLOCATED_FRAMES, and the stack doubles past that.
+int maxDepthHint(struct TreeNode* root, int nodeHint) {
     if (root == NULL)
         return 0;
-    l = maxDepth(root->left);
-    r = maxDepth(root->right);
-    return (l > r) ? (l + 1) : (r + 1);
+
+    int capacity = 64;
+    if (nodeHint > capacity)
+        capacity = nodeHint < MAX_PREALLOCATED_FRAMES ? nodeHint : MAX_PREALLOCATED_FRAMES;
+    Frame* stack = (Frame*)malloc(capacity * sizeof(Frame));
+    int top = 0, best = 0;
+    stack[top].node = root;
+    stack[top++].depth = 1;
+
+    while (top > 0) {
+        Frame f = stack[--top];
+        // Follow left children in place; only right children are pushed.
+        for (struct TreeNode* node = f.node; node != NULL; node = node->left, f.depth++) {
+            if (f.depth > best)
+                best = f.depth;
+            if (node->right) {
+                if (top == capacity) {
+                    capacity *= 2;
+                    stack = (Frame*)realloc(stack, capacity * sizeof(Frame));
+                }
+                stack[top].node = node->right;
+                stack[top++].depth = f.depth + 1;
+            }
+        }
+    }
+
+    free(stack);
+    return best;
 }
 
-struct TreeNode* newNode(int val) {
-    struct TreeNode* node = (struct TreeNode*)malloc(sizeof(struct TreeNode));
-    node->val = val;
-    node->left = NULL;
-    node->right = NULL;
-    return node;
+int maxDepth(struct TreeNode* root) {
+    return maxDepthHint(root, 0);
 }
 
 int main() {
-    struct TreeNode* root = newNode(1);
-    root->left = newNode(2);
-    root->right = newNode(3);
-    root->left->left = newNode(4);
-    root->left->right = newNode(5);
+    // All nodes come from one array; a single free releases the tree.
+    TreePool* pool = treeDeserialize("[1,2,3,4,5]");
+    struct TreeNode* root = treePoolToNodes(pool);
 
     int depth = maxDepth(root);
     printf("Maximum Depth of the Tree: %d\n", depth);
 
+    free(root);
+    treePoolFree(pool);
     return 0;
 }
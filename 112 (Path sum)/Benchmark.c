@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "PathSumIndex.h"
+
+/*
+   hasPathSum (main.c) and PathSumIndex against the plain recursive
+   definition, then many targets on one large tree.
+
+   Build:  gcc -O2 Benchmark.c PathSumIndex.c -o bench
+   Run:    ./bench [rounds] [nodes] [targets]
+
+   Each round builds a random tree (nodes hang off random empty child
+   slots) or a chain, with values in [-10, 10], anywhere in int, or in
+   [-2^24, 2^24], and asks targets drawn half from the tree's own leaf
+   sums and half at random, plus INT_MIN and INT_MAX. The timing part
+   asks `targets`
+   (default 200) targets of a `nodes`-node tree (default 2 * 10^5) with
+   values in [-2^24, 2^24], one hasPathSum call at a time and through one
+   index. Half the targets are leaf sums, half a leaf sum plus one, which
+   is almost never a path sum and makes hasPathSum walk the whole tree.
+*/
+
+#include "main.c"
+
+/* The recursive definition, with 64-bit remainders. */
+static bool hasPathSumRecursive(struct TreeNode* root, long long target) {
+    if (root == NULL) return false;
+    long long remaining = target - root->val;
+    if (root->left == NULL && root->right == NULL) return remaining == 0;
+    return hasPathSumRecursive(root->left, remaining) || hasPathSumRecursive(root->right, remaining);
+}
+
+/* Values in [-10, 10], anywhere in int, or in [-2^24, 2^24]. */
+static int randomValue(int range) {
+    if (range == 0) return (int)(nextRandom() % 21) - 10;
+    if (range == 1) return (int)nextRandom();
+    return (int)(nextRandom() % (2u << 24 | 1)) - (1 << 24);
+}
+
+/* n nodes in one array; node 0 is the root. */
+static struct TreeNode* buildTree(int n, int chain, int range) {
+    struct TreeNode* nodes = (struct TreeNode*)calloc(n, sizeof(struct TreeNode));
+    for (int i = 0; i < n; i++) nodes[i].val = randomValue(range);
+    for (int i = 1; i < n; i++) {
+        if (chain) {
+            if (nextRandom() % 2) nodes[i - 1].left = &nodes[i];
+            else nodes[i - 1].right = &nodes[i];
+            continue;
+        }
+        struct TreeNode* at = &nodes[0];
+        for (;;) {
+            struct TreeNode** slot = (nextRandom() % 2) ? &at->left : &at->right;
+            if (*slot == NULL) {
+                *slot = &nodes[i];
+                break;
+            }
+            at = *slot;
+        }
+    }
+    return nodes;
+}
+
+/* The sum of the path from the root down to a random leaf. */
+static long long randomLeafSum(struct TreeNode* root) {
+    long long sum = 0;
+    for (struct TreeNode* at = root; ; ) {
+        sum += at->val;
+        if (at->left == NULL && at->right == NULL) return sum;
+        if (at->left && at->right) at = (nextRandom() % 2) ? at->left : at->right;
+        else at = at->left ? at->left : at->right;
+    }
+}
+
+static int clampToInt(long long x) {
+    return x < INT_MIN ? INT_MIN : (x > INT_MAX ? INT_MAX : (int)x);
+}
+
+int main(int argc, char** argv) {
+    int rounds = (argc > 1) ? atoi(argv[1]) : 400;
+    int n = (argc > 2) ? atoi(argv[2]) : 200000;
+    int queries = (argc > 3) ? atoi(argv[3]) : 200;
+
+    int bad = 0, asked = 0;
+    int targets[82];
+    bool found[82];
+    for (int r = 0; r < rounds; r++) {
+        int size = 1 + nextRandom() % 2000;
+        int chain = (r % 4 == 0), range = r % 3;
+        struct TreeNode* nodes = buildTree(size, chain, range);
+        PathSumIndex* index = pathSumIndexBuild(nodes);
+
+        int count = 0;
+        targets[count++] = INT_MIN;
+        targets[count++] = INT_MAX;
+        while (count < 82) {
+            targets[count] = (count % 2) ? clampToInt(randomLeafSum(nodes)) : randomValue(range);
+            count++;
+        }
+        pathSumIndexHasBatch(index, targets, count, found);
+        for (int q = 0; q < count; q++) {
+            bool expected = hasPathSumRecursive(nodes, targets[q]);
+            bad += (hasPathSum(nodes, targets[q]) != expected);
+            bad += (pathSumIndexHas(index, targets[q]) != expected);
+            bad += (found[q] != expected);
+            asked++;
+        }
+        pathSumIndexFree(index);
+        free(nodes);
+    }
+    bool emptyBad = hasPathSum(NULL, 0);
+    PathSumIndex* empty = pathSumIndexBuild(NULL);
+    emptyBad |= pathSumIndexHas(empty, 0);
+    pathSumIndexFree(empty);
+    bad += emptyBad;
+    printf("%d trees, %d targets: %d wrong%s\n", rounds, asked, bad, bad ? "  (MISMATCH)" : "");
+
+    struct TreeNode* big = buildTree(n, 0, 2);
+    int* many = (int*)malloc(queries * sizeof(int));
+    bool* answers = (bool*)malloc(queries * sizeof(bool));
+    for (int q = 0; q < queries; q++) many[q] = clampToInt(randomLeafSum(big) + (q % 2));
+
+    double t0 = nowSeconds();
+    int hits = 0;
+    for (int q = 0; q < queries; q++) hits += hasPathSum(big, many[q]);
+    double tWalk = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    PathSumIndex* index = pathSumIndexBuild(big);
+    double tBuild = nowSeconds() - t0;
+    pathSumIndexHasBatch(index, many, queries, answers);
+    double tIndex = nowSeconds() - t0;
+    int indexHits = 0;
+    for (int q = 0; q < queries; q++) indexHits += answers[q];
+
+    printf("\n%d nodes, %d targets, %d distinct leaf sums\n", n, queries, index->count);
+    printf("%-22s %12.1f ms  (%d found)\n", "hasPathSum per target", tWalk * 1e3, hits);
+    printf("%-22s %12.1f ms  (build %.1f ms, %d found)%s\n", "index + batch", tIndex * 1e3,
+           tBuild * 1e3, indexHits, hits == indexHits ? "" : "  (MISMATCH)");
+
+    pathSumIndexFree(index);
+    free(many);
+    free(answers);
+    free(big);
+    return 0;
+}
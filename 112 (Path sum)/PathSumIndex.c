@@ -0,0 +1,80 @@
+#include <stdlib.h>
+#include "PathSumIndex.h"
+
+typedef struct {
+    struct TreeNode* node;
+    long long sum;      // sum from the root down to node, inclusive
+} Frame;
+
+static int compareSums(const void* a, const void* b) {
+    long long x = *(const long long*)a, y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+PathSumIndex* pathSumIndexBuild(struct TreeNode* root) {
+    PathSumIndex* index = (PathSumIndex*)malloc(sizeof(PathSumIndex));
+    int capacity = 64, stackCapacity = 64, top = 0;
+    index->sums = (long long*)malloc(capacity * sizeof(long long));
+    index->count = 0;
+    if (root == NULL) return index;
+
+    Frame* stack = (Frame*)malloc(stackCapacity * sizeof(Frame));
+    stack[top].node = root;
+    stack[top++].sum = root->val;
+    while (top > 0) {
+        Frame f = stack[--top];
+        struct TreeNode* kids[2] = { f.node->right, f.node->left };
+        if (kids[0] == NULL && kids[1] == NULL) {
+            if (index->count == capacity) {
+                capacity *= 2;
+                index->sums = (long long*)realloc(index->sums, capacity * sizeof(long long));
+            }
+            index->sums[index->count++] = f.sum;
+            continue;
+        }
+        if (top + 2 > stackCapacity) {
+            stackCapacity *= 2;
+            stack = (Frame*)realloc(stack, stackCapacity * sizeof(Frame));
+        }
+        for (int k = 0; k < 2; k++) {
+            if (kids[k] == NULL) continue;
+            stack[top].node = kids[k];
+            stack[top++].sum = f.sum + kids[k]->val;
+        }
+    }
+    free(stack);
+
+    qsort(index->sums, index->count, sizeof(long long), compareSums);
+    int distinct = 0;
+    for (int i = 0; i < index->count; i++) {
+        if (distinct == 0 || index->sums[distinct - 1] != index->sums[i]) {
+            index->sums[distinct++] = index->sums[i];
+        }
+    }
+    index->count = distinct;
+    return index;
+}
+
+void pathSumIndexFree(PathSumIndex* index) {
+    if (index == NULL) return;
+    free(index->sums);
+    free(index);
+}
+
+bool pathSumIndexHas(const PathSumIndex* index, long long target) {
+    // Branch-free search for the last sum <= target: halve the window,
+    // moving to the upper half when its first element is <= target.
+    const long long* base = index->sums;
+    int n = index->count;
+    if (n == 0) return false;
+    while (n > 1) {
+        int half = n / 2;
+        base = (base[half] <= target) ? base + half : base;
+        n -= half;
+    }
+    return *base == target;
+}
+
+void pathSumIndexHasBatch(const PathSumIndex* index, const int* targets, int count, bool* found) {
+    for (int i = 0; i < count; i++) found[i] = pathSumIndexHas(index, targets[i]);
+}
@@ -0,0 +1,30 @@
+#ifndef PATH_SUM_INDEX_H
+#define PATH_SUM_INDEX_H
+
+#include <stdbool.h>
+#include "../TREES/TreeNode.h"
+
+/*
+   Every root-to-leaf sum of one tree, sorted and de-duplicated, for
+   answering many hasPathSum targets on the same tree.
+
+   Building walks the tree once with an explicit stack (O(n) plus sorting
+   the L leaf sums); each target is then a binary search, O(log L). Sums
+   are 64-bit, so deep trees of large values do not overflow. Rebuild the
+   index after changing the tree.
+*/
+
+typedef struct {
+    long long* sums;    // ascending, distinct
+    int count;
+} PathSumIndex;
+
+PathSumIndex* pathSumIndexBuild(struct TreeNode* root);
+void pathSumIndexFree(PathSumIndex* index);
+
+bool pathSumIndexHas(const PathSumIndex* index, long long target);
+
+/* found[i] = pathSumIndexHas(index, targets[i]). */
+void pathSumIndexHasBatch(const PathSumIndex* index, const int* targets, int count, bool* found);
+
+#endif
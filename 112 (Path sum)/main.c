@@ -2,42 +2,53 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
-struct TreeNode{
-    int val ;
-    struct TreeNode *left;
-    struct TreeNode * right;
-};
+#include "../TREES/TreeNode.h"
 
-void check(struct TreeNode * root,int target,int * flag);
+/*
+   Depth-first walk with an explicit stack of (node, remaining target),
+   returning at the first leaf that matches. For many targets on the same
+   tree, build a PathSumIndex (PathSumIndex.h) once instead.
+*/
 
-void pre_order(struct TreeNode *root,int target,int *flag){
-    if (root==NULL)
-        return;
-
-    check(root,target,flag);
-
-    return;
-}
-
-
-void check(struct TreeNode *root, int target, int *flag) {
-    if (root == NULL)
-        return;
-    else if (root->val == target && root->left == NULL && root->right == NULL) {
-        *flag = 1;
-        return;
-    }
-    check(root->left, target - root->val, flag);
-    check(root->right, target - root->val, flag);
-}
+typedef struct {
+    struct TreeNode* node;
+    long long remaining;    // target minus the sum of the ancestors of node
+} Frame;
 
 bool hasPathSum(struct TreeNode* root, int targetSum) {
-    int flag=0;
-    pre_order(root,targetSum,&flag);
-
-    if(flag==1)
-        return true;
-    else
+    if (root == NULL)
         return false;
 
-}
\ No newline at end of file
+    int capacity = 64, top = 0;
+    Frame* stack = (Frame*)malloc(capacity * sizeof(Frame));
+    bool found = false;
+    stack[top].node = root;
+    stack[top++].remaining = targetSum;
+
+    while (top > 0) {
+        Frame f = stack[--top];
+        long long remaining = f.remaining - f.node->val;
+        if (f.node->left == NULL && f.node->right == NULL) {
+            if (remaining == 0) {
+                found = true;
+                break;
+            }
+            continue;
+        }
+        if (top + 2 > capacity) {
+            capacity *= 2;
+            stack = (Frame*)realloc(stack, capacity * sizeof(Frame));
+        }
+        if (f.node->right) {
+            stack[top].node = f.node->right;
+            stack[top++].remaining = remaining;
+        }
+        if (f.node->left) {
+            stack[top].node = f.node->left;
+            stack[top++].remaining = remaining;
+        }
+    }
+
+    free(stack);
+    return found;
+}
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "../BENCH/BenchUtil.h"
+#include "KEventsDP.h"
+#include "main.c"
+
+/*
+   maxValueRolling against the full-table maxValue of main.c, with the
+   peak resident memory of each.
+
+   Build:  gcc -O2 -mavx2 Benchmark.c KEventsDP.c -o bench
+           (drop -mavx2 for the scalar gather)
+   Run:    ./bench [n k]
+
+   Without arguments it runs n * k = 10^7 as (10^6, 10), (10^5, 100) and
+   (10^4, 1000), plus (10^6, 1) and (10^3, 10^4) at n * k = 10^6 and 10^7.
+   Starts are uniform in [1, 10^9], lengths uniform up to 50 times the
+   mean gap between starts, values uniform in [1, 10^6].
+
+   Every method runs in a forked child, so ru_maxrss from wait4 is that
+   method's own peak. The child inherits the generated events, so the
+   "input only" child, which touches them and exits, gives the baseline
+   to subtract.
+*/
+
+typedef struct {
+    double seconds;
+    int answer;
+} ChildResult;
+
+/* Runs method 0 (input only), 1 (full table) or 2 (rolling) in a child;
+   returns its peak RSS in KB. */
+static long runChild(int method, int** events, int n, int k, ChildResult* out) {
+    int fd[2];
+    if (pipe(fd) != 0) return -1;
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fd[0]);
+        ChildResult r = { 0, 0 };
+        double t0 = nowSeconds();
+        if (method == 0) {
+            for (int i = 0; i < n; i++) r.answer ^= events[i][2];
+        } else if (method == 1) {
+            r.answer = maxValue(events, n, NULL, k);
+        } else {
+            r.answer = maxValueRolling(events, n, NULL, k);
+        }
+        r.seconds = nowSeconds() - t0;
+        ssize_t written = write(fd[1], &r, sizeof(r));
+        _exit(written == sizeof(r) ? 0 : 1);
+    }
+    close(fd[1]);
+    ssize_t got = read(fd[0], out, sizeof(*out));
+    close(fd[0]);
+    int status;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+    if (got != sizeof(*out)) return -1;
+    return usage.ru_maxrss;
+}
+
+/* Generates the events and runs the three children. Called in a fresh
+   process per case, so no freed heap from an earlier case is already
+   resident and hidden in the baseline. */
+static void runCase(int n, int k) {
+    int* flat = (int*)malloc(3 * (size_t)n * sizeof(int));
+    int** events = (int**)malloc(n * sizeof(int*));
+    long long maxLength = 50LL * 1000000000 / n;
+    for (int i = 0; i < n; i++) {
+        int* e = flat + 3 * (size_t)i;
+        e[0] = 1 + (int)(nextRandom() % 1000000000u);
+        long long end = e[0] + (long long)(nextRandom() % (unsigned int)(maxLength + 1));
+        e[1] = (int)(end > 1000000000 ? 1000000000 : end);
+        e[2] = 1 + (int)(nextRandom() % 1000000u);
+        events[i] = e;
+    }
+
+    ChildResult base, full, rolling;
+    long baseKb = runChild(0, events, n, k, &base);
+    long fullKb = runChild(1, events, n, k, &full);
+    long rollingKb = runChild(2, events, n, k, &rolling);
+    printf("%9d %6d %12.1f %14ld %12.1f %14ld%s\n", n, k,
+           full.seconds * 1e3, fullKb - baseKb,
+           rolling.seconds * 1e3, rollingKb - baseKb,
+           full.answer == rolling.answer ? "" : "  (MISMATCH)");
+    free(flat);
+    free(events);
+}
+
+int main(int argc, char** argv) {
+    printf("%9s %6s %12s %14s %12s %14s\n", "n", "k", "table ms", "table peak KB",
+           "rolling ms", "rolling peak KB");
+    static const int cases[5][2] = {
+        { 1000000, 1 }, { 1000000, 10 }, { 100000, 100 }, { 10000, 1000 }, { 1000, 10000 }
+    };
+    for (int c = 0; c < 5; c++) {
+        int n = (argc > 2) ? atoi(argv[1]) : cases[c][0];
+        int k = (argc > 2) ? atoi(argv[2]) : cases[c][1];
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0) {
+            runCase(n, k);
+            fflush(stdout);
+            _exit(0);
+        }
+        waitpid(pid, NULL, 0);
+        if (argc > 2) break;
+    }
+    return 0;
+}
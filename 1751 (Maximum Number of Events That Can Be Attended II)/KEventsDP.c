@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "KEventsDP.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/* Sort key of a day: the sign bit flipped, so negative days order
+   before positive ones as unsigned keys. */
+static inline uint64_t dayKey(int day) {
+    return (uint64_t)((uint32_t)day ^ 0x80000000u);
+}
+
+/* LSD radix sort of (key << 32 | index) on the key half, 16 bits per
+   pass; tmp holds n entries. */
+static void sortByKey(uint64_t* a, uint64_t* tmp, int n) {
+    int* count = (int*)malloc((1 << 16) * sizeof(int));
+    for (int shift = 32; shift < 64; shift += 16) {
+        memset(count, 0, (1 << 16) * sizeof(int));
+        for (int i = 0; i < n; i++) count[(a[i] >> shift) & 0xFFFF]++;
+        int sum = 0;
+        for (int d = 0; d < (1 << 16); d++) {
+            int c = count[d];
+            count[d] = sum;
+            sum += c;
+        }
+        for (int i = 0; i < n; i++) tmp[count[(a[i] >> shift) & 0xFFFF]++] = a[i];
+        uint64_t* t = a;
+        a = tmp;
+        tmp = t;
+    }
+    // Two passes: the sorted data is back in the caller's a.
+    free(count);
+}
+
+/* cur[i] = prev[next[i]] + value[i] for i in [0, n). */
+static void takeColumn(const long long* prev, const int* next, const int* value,
+                       long long* cur, int n) {
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) {
+        __m128i idx = _mm_loadu_si128((const __m128i*)(next + i));
+        __m256i p = _mm256_i32gather_epi64((const long long*)prev, idx, 8);
+        __m256i v = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(value + i)));
+        _mm256_storeu_si256((__m256i*)(cur + i), _mm256_add_epi64(p, v));
+    }
+#endif
+    for (; i < n; i++) cur[i] = prev[next[i]] + value[i];
+}
+
+long long kEventsMaxValue(int** events, int n, int k) {
+    if (n <= 0 || k <= 0) return 0;
+    if (k > n) k = n;
+
+    uint64_t* order = (uint64_t*)malloc(2 * (size_t)n * sizeof(uint64_t));
+    uint64_t* tmp = order + n;
+    int* startSorted = (int*)malloc(n * sizeof(int));
+    int* next = (int*)malloc(n * sizeof(int));
+    int* value = (int*)malloc(n * sizeof(int));
+
+    for (int e = 0; e < n; e++) order[e] = dayKey(events[e][0]) << 32 | (uint32_t)e;
+    sortByKey(order, tmp, n);
+
+    // Re-key each slot by end, tagged with its position i in start order,
+    // so the end order directly names the row of next[] to fill.
+    for (int i = 0; i < n; i++) {
+        const int* ev = events[(uint32_t)order[i]];
+        startSorted[i] = ev[0];
+        value[i] = ev[2];
+        order[i] = dayKey(ev[1]) << 32 | (uint32_t)i;
+    }
+    sortByKey(order, tmp, n);
+
+    // Merge: walking events by increasing end, the first start > end
+    // only moves forward.
+    for (int j = 0, p = 0; j < n; j++) {
+        int end = (int)((uint32_t)(order[j] >> 32) ^ 0x80000000u);
+        while (p < n && startSorted[p] <= end) p++;
+        next[(uint32_t)order[j]] = p;
+    }
+    free(order);
+    free(startSorted);
+
+    // prev = column j - 1, cur = column j; both have the 0 sentinel at n.
+    long long* prev = (long long*)calloc(n + 1, sizeof(long long));
+    long long* cur = (long long*)malloc((n + 1) * sizeof(long long));
+    cur[n] = 0;
+    for (int j = 1; j <= k; j++) {
+        takeColumn(prev, next, value, cur, n);
+        int changed = 0;
+        for (int i = n - 1; i >= 0; i--) {
+            if (cur[i + 1] > cur[i]) cur[i] = cur[i + 1];
+            changed |= (cur[i] != prev[i]);
+        }
+        long long* t = prev;
+        prev = cur;
+        cur = t;
+        if (!changed) break;
+    }
+    long long best = prev[0];
+
+    free(prev);
+    free(cur);
+    free(next);
+    free(value);
+    return best;
+}
+
+int maxValueRolling(int** events, int eventsSize, int* eventsColSize, int k) {
+    (void)eventsColSize;
+    return (int)kEventsMaxValue(events, eventsSize, k);
+}
@@ -0,0 +1,30 @@
+#ifndef K_EVENTS_DP_H
+#define K_EVENTS_DP_H
+
+/*
+   The k-events DP of main.c without the (n + 1) x (k + 1) table.
+
+   Events are radix sorted by start and then, tagged with their start
+   position, by end. One merge over the two orders gives every
+   next(i) = first index whose start is > end_i, with no binary search.
+
+   The table is filled one pick count at a time. Column j only reads
+   column j - 1, so two rows of n + 1 int64 values are kept:
+
+       take[i]  = value_i + prev[next(i)]      (a gather, AVX2 when built
+                                                 with -mavx2)
+       cur[i]   = max(cur[i + 1], take[i])     (a suffix max)
+
+   If a column equals the previous one, every later column would too,
+   so the fill stops early; k is also capped at n. Memory is O(n)
+   regardless of k: 28 bytes per event while sorting, 24 during the DP.
+*/
+
+/* events[i] = [start, end, value]; the rows are only read. Days may be
+   any int, negative included. */
+long long kEventsMaxValue(int** events, int n, int k);
+
+/* Same contract as maxValue in main.c. */
+int maxValueRolling(int** events, int eventsSize, int* eventsColSize, int k);
+
+#endif
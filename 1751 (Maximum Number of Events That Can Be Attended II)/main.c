@@ -0,0 +1,44 @@
+#include <stdlib.h>
+
+/*
+   The DP of AlgorithFoundation.md as written: events sorted by start, a
+   full (n + 1) x (k + 1) table, next(i) by binary search over the starts
+   (once per event rather than once per (i, j)).
+*/
+
+static int byStart(const void* a, const void* b) {
+    const int* x = *(const int* const*)a;
+    const int* y = *(const int* const*)b;
+    if (x[0] != y[0]) return x[0] < y[0] ? -1 : 1;
+    return 0;
+}
+
+int maxValue(int** events, int eventsSize, int* eventsColSize, int k) {
+    (void)eventsColSize;
+    int n = eventsSize;
+    int** sorted = (int**)malloc(n * sizeof(int*));
+    for (int i = 0; i < n; i++) sorted[i] = events[i];
+    qsort(sorted, n, sizeof(int*), byStart);
+
+    long long* dp = (long long*)calloc((size_t)(n + 1) * (k + 1), sizeof(long long));
+    for (int i = n - 1; i >= 0; i--) {
+        // bisect_right(starts, end_i)
+        int lo = i + 1, hi = n;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (sorted[mid][0] <= sorted[i][1]) lo = mid + 1;
+            else hi = mid;
+        }
+        long long* row = dp + (size_t)i * (k + 1);
+        const long long* skip = row + (k + 1);
+        const long long* take = dp + (size_t)lo * (k + 1);
+        for (int j = 1; j <= k; j++) {
+            long long a = skip[j], b = sorted[i][2] + take[j - 1];
+            row[j] = a > b ? a : b;
+        }
+    }
+    long long best = dp[k];
+    free(dp);
+    free(sorted);
+    return (int)best;
+}
@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "FairPairs.h"
+
+/*
+   FairPairs.c (radix sort + two-pointer sweeps) against
+   "Optimized version.c" (qsort + two binary searches per element),
+   then the multi-range modes: one call per range, a prepared index
+   queried one range at a time, a batched query, and the pair-sum
+   histogram on small-range data.
+
+   Build:  gcc -O2 Benchmark.c FairPairs.c -o fairbench
+   Run:    ./fairbench [n] [rounds] [rangeQueries]
+*/
+
+#define countFairPairs countFairPairsQsort
+#include "Optimized version.c"
+#undef countFairPairs
+
+static void multiRange(const int* nums, int n, int queries, int* scratch, const char* label) {
+    int* lower = (int*)malloc(queries * sizeof(int));
+    int* upper = (int*)malloc(queries * sizeof(int));
+    long long* expected = (long long*)malloc(queries * sizeof(long long));
+    long long* got = (long long*)malloc(queries * sizeof(long long));
+    int lo = nums[0], hi = nums[0];
+    for (int i = 1; i < n; i++) {
+        if (nums[i] < lo) lo = nums[i];
+        if (nums[i] > hi) hi = nums[i];
+    }
+    long long span = 2LL * hi - 2LL * lo + 1;
+    for (int q = 0; q < queries; q++) {
+        long long a = 2LL * lo + rand() % span;
+        long long b = 2LL * lo + rand() % span;
+        lower[q] = (int)(a < b ? a : b);
+        upper[q] = (int)(a < b ? b : a);
+    }
+
+    double t0 = nowSeconds();
+    for (int q = 0; q < queries; q++) {
+        expected[q] = countFairPairsRadix(nums, n, lower[q], upper[q], scratch);
+    }
+    double t1 = nowSeconds();
+    FairPairsIndex* index = fairPairsPrepare(nums, n, 0);
+    double t2 = nowSeconds();
+    int bad = 0;
+    for (int q = 0; q < queries; q++) bad += (fairPairsQuery(index, lower[q], upper[q]) != expected[q]);
+    double t3 = nowSeconds();
+    fairPairsQueryBatch(index, lower, upper, queries, got);
+    double t4 = nowSeconds();
+    for (int q = 0; q < queries; q++) bad += (got[q] != expected[q]);
+    fairPairsIndexFree(index);
+
+    printf("%s: %d ranges, values in [%d, %d]\n", label, queries, lo, hi);
+    printf("  re-sort per call   %10.1f ms\n", (t1 - t0) * 1e3);
+    printf("  prepare            %10.1f ms\n", (t2 - t1) * 1e3);
+    printf("  query one by one   %10.1f ms\n", (t3 - t2) * 1e3);
+    printf("  query batch        %10.1f ms\n", (t4 - t3) * 1e3);
+
+    double t5 = nowSeconds();
+    index = fairPairsPrepare(nums, n, FAIR_PAIRS_HISTOGRAM_RANGE);
+    double t6 = nowSeconds();
+    if (fairPairsHasHistogram(index)) {
+        fairPairsQueryBatch(index, lower, upper, queries, got);
+        double t7 = nowSeconds();
+        for (int q = 0; q < queries; q++) bad += (got[q] != expected[q]);
+        printf("  histogram prepare  %10.1f ms\n", (t6 - t5) * 1e3);
+        printf("  histogram queries  %10.3f ms\n", (t7 - t6) * 1e3);
+    }
+    fairPairsIndexFree(index);
+    if (bad) printf("  MISMATCH in %d answers\n", bad);
+
+    free(lower);
+    free(upper);
+    free(expected);
+    free(got);
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int rounds = (argc > 2) ? atoi(argv[2]) : 3;
+    int rangeQueries = (argc > 3) ? atoi(argv[3]) : 200;
+
+    srand(2563);
+    int* nums = (int*)malloc(n * sizeof(int));
+    int* scratch = (int*)malloc(2 * (size_t)n * sizeof(int));
+
+    printf("n = %d\n", n);
+    printf("%-6s %12s %12s %20s\n", "round", "qsort ms", "radix ms", "pairs");
+    for (int r = 0; r < rounds; r++) {
+        // Values in the LeetCode range [-1e9, 1e9].
+        for (int i = 0; i < n; i++) {
+            nums[i] = (int)(((long long)rand() * RAND_MAX + rand()) % 2000000001LL) - 1000000000;
+        }
+        int lower = -(rand() % 1000000000);
+        int upper = lower + rand() % 1000000000;
+
+        double t0 = nowSeconds();
+        long long expected = countFairPairsQsort(nums, n, lower, upper);
+        double t1 = nowSeconds();
+        long long got = countFairPairsRadix(nums, n, lower, upper, scratch);
+        double t2 = nowSeconds();
+
+        printf("%-6d %12.1f %12.1f %20lld%s\n", r, (t1 - t0) * 1e3, (t2 - t1) * 1e3,
+               got, got == expected ? "" : "  (MISMATCH)");
+    }
+
+    // Multi-range mode on a tenth of the data, wide and narrow value ranges.
+    int m = n / 10 > 1 ? n / 10 : 2;
+    multiRange(nums, m, rangeQueries, scratch, "wide");
+    for (int i = 0; i < m; i++) nums[i] = rand() % 2001 - 1000;
+    multiRange(nums, m, rangeQueries, scratch, "narrow");
+
+    free(nums);
+    free(scratch);
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "FairPairs.h"
+#include "DynamicFairPairs.h"
+
+/*
+   DynamicFairPairs under a stream of mixed inserts and erases.
+
+   Build:  gcc -O2 DynamicBenchmark.c DynamicFairPairs.c FairPairs.c -o dynbench
+   Run:    ./dynbench [updates] [rangeQueries]
+
+   Both backends replay the same operations; the final fixed-range count
+   and a few ad-hoc ranges are checked against countFairPairsRadix on the
+   final multiset.
+*/
+
+static int randomValue(void) {
+    return (int)(((long long)rand() * RAND_MAX + rand()) % 2000000001LL) - 1000000000;
+}
+
+int main(int argc, char** argv) {
+    int updates = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int rangeQueries = (argc > 2) ? atoi(argv[2]) : 20;
+    int lower = -500000000, upper = 500000000;
+
+    // Operation log: step i inserts value[i], or erases it if isErase[i].
+    srand(31);
+    int* value = (int*)malloc(updates * sizeof(int));
+    char* isErase = (char*)malloc(updates);
+    int* live = (int*)malloc(updates * sizeof(int));
+    int liveCount = 0;
+    for (int i = 0; i < updates; i++) {
+        if (liveCount > 0 && rand() % 5 < 2) {
+            int k = rand() % liveCount;
+            value[i] = live[k];
+            live[k] = live[--liveCount];
+            isErase[i] = 1;
+        } else {
+            value[i] = randomValue();
+            live[liveCount++] = value[i];
+            isErase[i] = 0;
+        }
+    }
+
+    DynamicFairPairs* sets[2];
+    const char* names[2] = { "fenwick", "treap" };
+    double t0 = nowSeconds();
+    sets[0] = dfpCreateFenwick(value, updates, lower, upper);
+    double fenwickBuild = nowSeconds() - t0;
+    sets[1] = dfpCreateTreap(lower, upper);
+
+    long long* answers = (long long*)malloc(rangeQueries * sizeof(long long));
+    int* ql = (int*)malloc(rangeQueries * sizeof(int));
+    int* qu = (int*)malloc(rangeQueries * sizeof(int));
+    for (int q = 0; q < rangeQueries; q++) {
+        long long a = 2LL * randomValue();
+        long long b = a + rand() % 1000000000;
+        ql[q] = (int)(a < -2147483647LL ? -2147483647LL : (a > 2147483647LL ? 2147483647LL : a));
+        qu[q] = (int)(b > 2147483647LL ? 2147483647LL : (b < -2147483647LL ? -2147483647LL : b));
+    }
+
+    long long expected = countFairPairsRadix(live, liveCount, lower, upper, NULL);
+
+    printf("updates = %d, final size = %d, fenwick universe build %.1f ms\n",
+           updates, liveCount, fenwickBuild * 1e3);
+    printf("%-8s %14s %16s\n", "backend", "updates/s", "range query ms");
+    for (int s = 0; s < 2; s++) {
+        t0 = nowSeconds();
+        for (int i = 0; i < updates; i++) {
+            if (isErase[i]) dfpErase(sets[s], value[i]);
+            else dfpInsert(sets[s], value[i]);
+        }
+        double t = nowSeconds() - t0;
+
+        int bad = (dfpCount(sets[s]) != expected);
+        t0 = nowSeconds();
+        for (int q = 0; q < rangeQueries; q++) answers[q] = dfpCountRange(sets[s], ql[q], qu[q]);
+        double tq = nowSeconds() - t0;
+        for (int q = 0; q < rangeQueries; q++) {
+            bad += (answers[q] != countFairPairsRadix(live, liveCount, ql[q], qu[q], NULL));
+        }
+
+        printf("%-8s %14.0f %16.2f%s\n", names[s], updates / t,
+               rangeQueries ? tq * 1e3 / rangeQueries : 0.0, bad ? "  (MISMATCH)" : "");
+        dfpFree(sets[s]);
+    }
+
+    free(value);
+    free(isErase);
+    free(live);
+    free(answers);
+    free(ql);
+    free(qu);
+    return 0;
+}
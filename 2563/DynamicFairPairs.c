@@ -0,0 +1,355 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "FairPairs.h"
+#include "DynamicFairPairs.h"
+
+typedef enum {
+    DFP_FENWICK,
+    DFP_TREAP
+} DFPBackend;
+
+/* Fenwick tree over the sorted, de-duplicated universe. */
+typedef struct {
+    int* values;        // m distinct values, ascending
+    int* tree;          // 1-based Fenwick array, m + 1 entries
+    int* count;         // multiplicity of values[i]
+    int m;
+} Fenwick;
+
+/* Treap node pool; index 0 is the empty tree. */
+typedef struct {
+    int* key;
+    unsigned int* priority;
+    int* count;         // multiplicity of key
+    int* size;          // elements (with multiplicity) in the subtree
+    int* left;
+    int* right;
+    int used;           // nodes handed out, including 0
+    int capacity;
+    int freeList;       // recycled nodes, chained through left[]
+    int root;
+    unsigned int seed;
+} Treap;
+
+struct DynamicFairPairs {
+    DFPBackend backend;
+    int lower;
+    int upper;
+    int size;
+    long long pairs;
+    Fenwick fw;
+    Treap tr;
+};
+
+/* ---------- Fenwick backend ---------- */
+
+static int fenwickPrefix(const Fenwick* f, int i) {
+    int s = 0;
+    for (; i > 0; i -= i & -i) s += f->tree[i];
+    return s;
+}
+
+static void fenwickAdd(Fenwick* f, int i, int delta) {
+    for (i++; i <= f->m; i += i & -i) f->tree[i] += delta;
+}
+
+/* Smallest i whose prefix (elements in values[0..i]) exceeds k, for
+   0 <= k < total; walks down the implicit tree in O(log m). */
+static int fenwickSelect(const Fenwick* f, int k) {
+    int pos = 0, step = 1;
+    while (step * 2 <= f->m) step *= 2;
+    for (; step > 0; step >>= 1) {
+        if (pos + step <= f->m && f->tree[pos + step] <= k) {
+            pos += step;
+            k -= f->tree[pos];
+        }
+    }
+    return pos;
+}
+
+/* Number of universe values <= x. */
+static int fenwickRank(const Fenwick* f, long long x) {
+    int lo = 0, hi = f->m;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (f->values[mid] <= x) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static int fenwickIndexOf(const Fenwick* f, int x) {
+    int r = fenwickRank(f, x);
+    return (r > 0 && f->values[r - 1] == x) ? r - 1 : -1;
+}
+
+/* ---------- treap backend ---------- */
+
+static int treapNew(Treap* t, int key) {
+    int v;
+    if (t->freeList) {
+        v = t->freeList;
+        t->freeList = t->left[v];
+    } else {
+        if (t->used == t->capacity) {
+            t->capacity *= 2;
+            t->key = (int*)realloc(t->key, t->capacity * sizeof(int));
+            t->priority = (unsigned int*)realloc(t->priority, t->capacity * sizeof(unsigned int));
+            t->count = (int*)realloc(t->count, t->capacity * sizeof(int));
+            t->size = (int*)realloc(t->size, t->capacity * sizeof(int));
+            t->left = (int*)realloc(t->left, t->capacity * sizeof(int));
+            t->right = (int*)realloc(t->right, t->capacity * sizeof(int));
+        }
+        v = t->used++;
+    }
+    t->seed ^= t->seed << 13;
+    t->seed ^= t->seed >> 17;
+    t->seed ^= t->seed << 5;
+    t->key[v] = key;
+    t->priority[v] = t->seed;
+    t->count[v] = 1;
+    t->size[v] = 1;
+    t->left[v] = 0;
+    t->right[v] = 0;
+    return v;
+}
+
+static void treapPull(Treap* t, int v) {
+    t->size[v] = t->count[v] + t->size[t->left[v]] + t->size[t->right[v]];
+}
+
+/* Splits v into keys < key (*a) and keys >= key (*b). */
+static void treapSplit(Treap* t, int v, long long key, int* a, int* b) {
+    if (v == 0) {
+        *a = *b = 0;
+        return;
+    }
+    if (t->key[v] < key) {
+        treapSplit(t, t->right[v], key, &t->right[v], b);
+        *a = v;
+    } else {
+        treapSplit(t, t->left[v], key, a, &t->left[v]);
+        *b = v;
+    }
+    treapPull(t, v);
+}
+
+static int treapMerge(Treap* t, int a, int b) {
+    if (a == 0) return b;
+    if (b == 0) return a;
+    if (t->priority[a] > t->priority[b]) {
+        t->right[a] = treapMerge(t, t->right[a], b);
+        treapPull(t, a);
+        return a;
+    }
+    t->left[b] = treapMerge(t, a, t->left[b]);
+    treapPull(t, b);
+    return b;
+}
+
+/* Elements <= x. */
+static int treapRank(const Treap* t, long long x) {
+    int r = 0;
+    for (int v = t->root; v != 0; ) {
+        if (t->key[v] <= x) {
+            r += t->size[t->left[v]] + t->count[v];
+            v = t->right[v];
+        } else {
+            v = t->left[v];
+        }
+    }
+    return r;
+}
+
+static int treapFind(const Treap* t, int x) {
+    int v = t->root;
+    while (v != 0 && t->key[v] != x) v = (x < t->key[v]) ? t->left[v] : t->right[v];
+    return v;
+}
+
+/* Adds delta to the multiplicity of an existing key and the sizes on its path. */
+static void treapBump(Treap* t, int x, int delta) {
+    int v = t->root;
+    while (true) {
+        t->size[v] += delta;
+        if (t->key[v] == x) break;
+        v = (x < t->key[v]) ? t->left[v] : t->right[v];
+    }
+    t->count[v] += delta;
+}
+
+static void treapInsert(Treap* t, int x) {
+    if (treapFind(t, x)) {
+        treapBump(t, x, 1);
+        return;
+    }
+    int a, b;
+    treapSplit(t, t->root, x, &a, &b);
+    t->root = treapMerge(t, treapMerge(t, a, treapNew(t, x)), b);
+}
+
+static void treapErase(Treap* t, int x) {
+    int v = treapFind(t, x);
+    if (t->count[v] > 1) {
+        treapBump(t, x, -1);
+        return;
+    }
+    int a, b, c;
+    treapSplit(t, t->root, x, &a, &b);
+    treapSplit(t, b, (long long)x + 1, &b, &c);
+    t->left[b] = t->freeList;
+    t->freeList = b;
+    t->root = treapMerge(t, a, c);
+}
+
+/* ---------- shared ---------- */
+
+static int multisetRank(const DynamicFairPairs* d, long long x) {
+    if (d->backend == DFP_FENWICK) return fenwickPrefix(&d->fw, fenwickRank(&d->fw, x));
+    return treapRank(&d->tr, x);
+}
+
+/* Elements y with lo <= y <= hi. */
+static long long countBetween(const DynamicFairPairs* d, long long lo, long long hi) {
+    if (lo > hi) return 0;
+    return multisetRank(d, hi) - multisetRank(d, lo - 1);
+}
+
+static DynamicFairPairs* dfpAlloc(DFPBackend backend, int lower, int upper) {
+    DynamicFairPairs* d = (DynamicFairPairs*)calloc(1, sizeof(DynamicFairPairs));
+    d->backend = backend;
+    d->lower = lower;
+    d->upper = upper;
+    return d;
+}
+
+DynamicFairPairs* dfpCreateFenwick(const int* universe, int universeSize, int lower, int upper) {
+    DynamicFairPairs* d = dfpAlloc(DFP_FENWICK, lower, upper);
+    Fenwick* f = &d->fw;
+    int n = universeSize > 0 ? universeSize : 1;
+    f->values = (int*)malloc(n * sizeof(int));
+    int* tmp = (int*)malloc(n * sizeof(int));
+    memcpy(f->values, universe, universeSize * sizeof(int));
+    fairPairsSort(f->values, universeSize, tmp);
+    free(tmp);
+    f->m = 0;
+    for (int i = 0; i < universeSize; i++) {
+        if (f->m == 0 || f->values[f->m - 1] != f->values[i]) f->values[f->m++] = f->values[i];
+    }
+    f->tree = (int*)calloc(f->m + 1, sizeof(int));
+    f->count = (int*)calloc(f->m > 0 ? f->m : 1, sizeof(int));
+    return d;
+}
+
+DynamicFairPairs* dfpCreateTreap(int lower, int upper) {
+    DynamicFairPairs* d = dfpAlloc(DFP_TREAP, lower, upper);
+    Treap* t = &d->tr;
+    t->capacity = 64;
+    t->key = (int*)calloc(t->capacity, sizeof(int));
+    t->priority = (unsigned int*)calloc(t->capacity, sizeof(unsigned int));
+    t->count = (int*)calloc(t->capacity, sizeof(int));
+    t->size = (int*)calloc(t->capacity, sizeof(int));
+    t->left = (int*)calloc(t->capacity, sizeof(int));
+    t->right = (int*)calloc(t->capacity, sizeof(int));
+    t->used = 1;
+    t->seed = 2463534242u;
+    return d;
+}
+
+void dfpFree(DynamicFairPairs* d) {
+    if (d == NULL) return;
+    free(d->fw.values);
+    free(d->fw.tree);
+    free(d->fw.count);
+    free(d->tr.key);
+    free(d->tr.priority);
+    free(d->tr.count);
+    free(d->tr.size);
+    free(d->tr.left);
+    free(d->tr.right);
+    free(d);
+}
+
+int dfpInsert(DynamicFairPairs* d, int x) {
+    int idx = -1;
+    if (d->backend == DFP_FENWICK) {
+        idx = fenwickIndexOf(&d->fw, x);
+        if (idx < 0) return 0;
+    }
+    // Pairs x forms with the elements already present.
+    d->pairs += countBetween(d, (long long)d->lower - x, (long long)d->upper - x);
+    if (d->backend == DFP_FENWICK) {
+        fenwickAdd(&d->fw, idx, 1);
+        d->fw.count[idx]++;
+    } else {
+        treapInsert(&d->tr, x);
+    }
+    d->size++;
+    return 1;
+}
+
+int dfpErase(DynamicFairPairs* d, int x) {
+    if (d->backend == DFP_FENWICK) {
+        int idx = fenwickIndexOf(&d->fw, x);
+        if (idx < 0 || d->fw.count[idx] == 0) return 0;
+        fenwickAdd(&d->fw, idx, -1);
+        d->fw.count[idx]--;
+    } else {
+        if (treapFind(&d->tr, x) == 0) return 0;
+        treapErase(&d->tr, x);
+    }
+    d->size--;
+    d->pairs -= countBetween(d, (long long)d->lower - x, (long long)d->upper - x);
+    return 1;
+}
+
+int dfpSize(const DynamicFairPairs* d) {
+    return d->size;
+}
+
+long long dfpCount(const DynamicFairPairs* d) {
+    return d->pairs;
+}
+
+long long dfpCountRange(const DynamicFairPairs* d, int lower, int upper) {
+    if (lower > upper) return 0;
+    // Ordered pairs (x, y) over distinct values x, minus x paired with
+    // itself, halved.
+    long long ordered = 0, self = 0;
+    if (d->backend == DFP_FENWICK) {
+        // A sparse multiset jumps from one present value to the next by
+        // selecting the element after the ones counted so far, O(log m)
+        // each; a dense one scans count[] in order, which is cheaper per
+        // step than a select.
+        const Fenwick* f = &d->fw;
+        int sparse = (long long)d->size * 8 < f->m;
+        for (int i = 0, seen = 0; seen < d->size; i++) {
+            if (sparse) i = fenwickSelect(f, seen);
+            int c = f->count[i];
+            if (c == 0) continue;
+            seen += c;
+            long long x = f->values[i];
+            ordered += c * countBetween(d, lower - x, upper - x);
+            if (lower <= 2 * x && 2 * x <= upper) self += c;
+        }
+    } else {
+        const Treap* t = &d->tr;
+        int* stack = (int*)malloc((t->used + 1) * sizeof(int));
+        int top = 0;
+        for (int v = t->root; v != 0 || top > 0; ) {
+            if (v != 0) {
+                stack[top++] = v;
+                v = t->left[v];
+                continue;
+            }
+            v = stack[--top];
+            long long x = t->key[v];
+            ordered += t->count[v] * countBetween(d, lower - x, upper - x);
+            if (lower <= 2 * x && 2 * x <= upper) self += t->count[v];
+            v = t->right[v];
+        }
+        free(stack);
+    }
+    return (ordered - self) / 2;
+}
@@ -0,0 +1,38 @@
+#ifndef DYNAMIC_FAIR_PAIRS_H
+#define DYNAMIC_FAIR_PAIRS_H
+
+/*
+   Fair-pair count over a multiset that changes between queries.
+
+   The structure keeps the number of pairs with lower <= x + y <= upper
+   for one fixed (lower, upper) up to date: inserting or erasing x adds or
+   removes the pairs x forms with the other elements, which is one range
+   count, O(log n). Any other range can be asked with dfpCountRange in
+   O(d log n), d = number of distinct values present. The Fenwick backend
+   gets there by stepping between present values by order statistic when
+   fewer than 1/8 of the universe is present, and otherwise scans the
+   universe, O(U + d log U).
+
+   Two backends answer the range counts:
+   - Fenwick tree over coordinate-compressed values. Every value that will
+     ever be inserted must be listed up front in the universe.
+   - Treap keyed by value with subtree sizes (an order-statistics tree),
+     for when values are not known in advance.
+*/
+
+typedef struct DynamicFairPairs DynamicFairPairs;
+
+DynamicFairPairs* dfpCreateFenwick(const int* universe, int universeSize, int lower, int upper);
+DynamicFairPairs* dfpCreateTreap(int lower, int upper);
+void dfpFree(DynamicFairPairs* d);
+
+/* Return 0 (and change nothing) if x is outside the Fenwick universe,
+   or, for dfpErase, if x is not in the multiset. */
+int dfpInsert(DynamicFairPairs* d, int x);
+int dfpErase(DynamicFairPairs* d, int x);
+
+int dfpSize(const DynamicFairPairs* d);
+long long dfpCount(const DynamicFairPairs* d);
+long long dfpCountRange(const DynamicFairPairs* d, int lower, int upper);
+
+#endif
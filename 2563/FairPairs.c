@@ -0,0 +1,271 @@
+#include <stdlib.h>
+#include <string.h>
+#include "FairPairs.h"
+
+#define RADIX_BITS 8
+#define RADIX_SIZE (1 << RADIX_BITS)
+#define RADIX_PASSES (32 / RADIX_BITS)
+
+static inline unsigned int radixKey(int x) {
+    return (unsigned int)x ^ 0x80000000u;
+}
+
+void fairPairsSort(int* a, int n, int* tmp) {
+    // One read builds the histograms of all four digits.
+    unsigned int count[RADIX_PASSES][RADIX_SIZE];
+    memset(count, 0, sizeof(count));
+    for (int i = 0; i < n; i++) {
+        unsigned int k = radixKey(a[i]);
+        count[0][k & 0xFF]++;
+        count[1][(k >> 8) & 0xFF]++;
+        count[2][(k >> 16) & 0xFF]++;
+        count[3][k >> 24]++;
+    }
+
+    int* src = a;
+    int* dst = tmp;
+    for (int pass = 0; pass < RADIX_PASSES; pass++) {
+        unsigned int* c = count[pass];
+        int shift = pass * RADIX_BITS;
+
+        // A digit shared by every key would only copy the array; skip it.
+        if (n == 0 || c[(radixKey(src[0]) >> shift) & 0xFF] == (unsigned int)n) continue;
+
+        unsigned int sum = 0;
+        for (int d = 0; d < RADIX_SIZE; d++) {
+            unsigned int t = c[d];
+            c[d] = sum;
+            sum += t;
+        }
+        for (int i = 0; i < n; i++) {
+            int x = src[i];
+            dst[c[(radixKey(x) >> shift) & 0xFF]++] = x;
+        }
+        int* t = src; src = dst; dst = t;
+    }
+    if (src != a) memcpy(a, src, n * sizeof(int));
+}
+
+long long fairPairsAtMost(const int* sorted, int n, long long bound) {
+    long long count = 0;
+    int i = 0, j = n - 1;
+    // For each i, j only ever moves left, so the sweep is O(n).
+    while (i < j) {
+        if ((long long)sorted[i] + sorted[j] <= bound) {
+            count += j - i;
+            i++;
+        } else {
+            j--;
+        }
+    }
+    return count;
+}
+
+long long fairPairsCountSorted(const int* sorted, int n, int lower, int upper) {
+    if (lower > upper) return 0;
+    return fairPairsAtMost(sorted, n, upper) - fairPairsAtMost(sorted, n, (long long)lower - 1);
+}
+
+long long countFairPairsRadix(const int* nums, int numsSize, int lower, int upper, int* scratch) {
+    int* buffer = scratch ? scratch : (int*)malloc(2 * (size_t)numsSize * sizeof(int));
+    memcpy(buffer, nums, numsSize * sizeof(int));
+    fairPairsSort(buffer, numsSize, buffer + numsSize);
+    long long count = fairPairsCountSorted(buffer, numsSize, lower, upper);
+    if (scratch == NULL) free(buffer);
+    return count;
+}
+
+/* ---------- prepared index ---------- */
+
+struct FairPairsIndex {
+    int n;
+    int* sorted;
+    // Run-length form of sorted, present when values repeat enough:
+    // value[0..distinct) ascending, prefix[x] = elements below value[x].
+    int distinct;
+    int* value;
+    int* prefix;
+    // Pair-sum distribution, present when the value range is small:
+    // cumulative[s + 1] = pairs with nums[i] + nums[j] - 2 * minValue <= s.
+    long long* cumulative;
+    long long sumRange;     // largest shifted sum, 2 * (max - min)
+    long long sumBase;      // 2 * minValue
+};
+
+static void buildHistogram(FairPairsIndex* index, int range) {
+    const int* a = index->sorted;
+    int n = index->n;
+
+    // Distinct values (offset by the minimum) and their multiplicities.
+    int* value = (int*)malloc(n * sizeof(int));
+    long long* count = (long long*)malloc(n * sizeof(long long));
+    int distinct = 0;
+    for (int i = 0; i < n; i++) {
+        int v = a[i] - a[0];
+        if (distinct > 0 && value[distinct - 1] == v) {
+            count[distinct - 1]++;
+        } else {
+            value[distinct] = v;
+            count[distinct++] = 1;
+        }
+    }
+
+    // Self-convolution restricted to unordered pairs i < j.
+    long long sums = 2LL * range + 1;
+    long long* pairs = (long long*)calloc(sums + 1, sizeof(long long));
+    for (int x = 0; x < distinct; x++) {
+        pairs[2 * value[x] + 1] += count[x] * (count[x] - 1) / 2;
+        for (int y = x + 1; y < distinct; y++) {
+            pairs[value[x] + value[y] + 1] += count[x] * count[y];
+        }
+    }
+    for (long long s = 1; s <= sums; s++) pairs[s] += pairs[s - 1];
+
+    index->cumulative = pairs;
+    index->sumRange = 2LL * range;
+    index->sumBase = 2LL * a[0];
+    free(value);
+    free(count);
+}
+
+static void buildDistinct(FairPairsIndex* index) {
+    const int* a = index->sorted;
+    int n = index->n;
+    int distinct = 0;
+    for (int i = 0; i < n; i++) distinct += (i == 0 || a[i] != a[i - 1]);
+    // The run-length sweep costs a multiply per distinct value instead of
+    // a compare per element; it only pays off with enough repeats.
+    if (distinct == 0 || 2LL * distinct > n) return;
+
+    index->distinct = distinct;
+    index->value = (int*)malloc(distinct * sizeof(int));
+    index->prefix = (int*)malloc((distinct + 1) * sizeof(int));
+    int d = 0;
+    for (int i = 0; i < n; i++) {
+        if (i == 0 || a[i] != a[i - 1]) {
+            index->value[d] = a[i];
+            index->prefix[d++] = i;
+        }
+    }
+    index->prefix[distinct] = n;
+}
+
+FairPairsIndex* fairPairsPrepare(const int* nums, int numsSize, int histogramMaxRange) {
+    FairPairsIndex* index = (FairPairsIndex*)calloc(1, sizeof(FairPairsIndex));
+    index->n = numsSize;
+    index->sorted = (int*)malloc((numsSize > 0 ? numsSize : 1) * sizeof(int));
+    int* tmp = (int*)malloc((numsSize > 0 ? numsSize : 1) * sizeof(int));
+    memcpy(index->sorted, nums, numsSize * sizeof(int));
+    fairPairsSort(index->sorted, numsSize, tmp);
+    free(tmp);
+
+    if (numsSize > 1) {
+        long long range = (long long)index->sorted[numsSize - 1] - index->sorted[0];
+        if (histogramMaxRange > 0 && range <= histogramMaxRange) buildHistogram(index, (int)range);
+    }
+    if (index->cumulative == NULL) buildDistinct(index);
+    return index;
+}
+
+void fairPairsIndexFree(FairPairsIndex* index) {
+    if (index == NULL) return;
+    free(index->sorted);
+    free(index->cumulative);
+    free(index->value);
+    free(index->prefix);
+    free(index);
+}
+
+int fairPairsHasHistogram(const FairPairsIndex* index) {
+    return index->cumulative != NULL;
+}
+
+/* Pairs i < j with sum <= bound, on the run-length form when there is one. */
+static long long indexAtMost(const FairPairsIndex* index, long long bound) {
+    if (index->value == NULL) return fairPairsAtMost(index->sorted, index->n, bound);
+    // Ordered pairs (x, y), x == y included, minus the elements paired
+    // with themselves, halved.
+    const int* v = index->value;
+    const int* prefix = index->prefix;
+    long long ordered = 0, self = 0;
+    int y = index->distinct - 1;
+    for (int x = 0; x < index->distinct; x++) {
+        while (y >= 0 && (long long)v[x] + v[y] > bound) y--;
+        if (y < 0) break;
+        long long c = prefix[x + 1] - prefix[x];
+        ordered += c * prefix[y + 1];
+        if (2LL * v[x] <= bound) self += c;
+    }
+    return (ordered - self) / 2;
+}
+
+long long fairPairsQuery(const FairPairsIndex* index, int lower, int upper) {
+    if (lower > upper) return 0;
+    if (index->cumulative == NULL) {
+        return indexAtMost(index, upper) - indexAtMost(index, (long long)lower - 1);
+    }
+    long long lo = (long long)lower - index->sumBase;
+    long long hi = (long long)upper - index->sumBase;
+    if (lo < 0) lo = 0;
+    if (hi > index->sumRange) hi = index->sumRange;
+    if (lo > hi) return 0;
+    return index->cumulative[hi + 1] - index->cumulative[lo];
+}
+
+static int compareBounds(const void* a, const void* b) {
+    long long x = *(const long long*)a;
+    long long y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+/* Position of bound in the sorted, de-duplicated array bounds[0..m). */
+static int findBound(const long long* bounds, int m, long long bound) {
+    int lo = 0, hi = m - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (bounds[mid] < bound) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void fairPairsQueryBatch(const FairPairsIndex* index, const int* lower, const int* upper,
+                         int queries, long long* out) {
+    if (index->cumulative != NULL || queries == 0) {
+        for (int q = 0; q < queries; q++) out[q] = fairPairsQuery(index, lower[q], upper[q]);
+        return;
+    }
+
+    // Every query needs atMost(upper) and atMost(lower - 1); sweep each
+    // distinct bound once.
+    long long* bounds = (long long*)malloc(2 * (size_t)queries * sizeof(long long));
+    int m = 0;
+    for (int q = 0; q < queries; q++) {
+        bounds[m++] = upper[q];
+        bounds[m++] = (long long)lower[q] - 1;
+    }
+    qsort(bounds, m, sizeof(long long), compareBounds);
+    int distinct = 0;
+    for (int b = 0; b < m; b++) {
+        if (distinct == 0 || bounds[distinct - 1] != bounds[b]) bounds[distinct++] = bounds[b];
+    }
+    m = distinct;
+
+    // One sweep per distinct bound, in order. Interleaving the sweeps
+    // (one right pointer per bound, all advanced for each i) does the same
+    // O(n) work per bound and measured slower once the pointers no longer
+    // fit in L1, so the saving is only the endpoints queries share.
+    long long* atMost = (long long*)malloc(m * sizeof(long long));
+    for (int b = 0; b < m; b++) atMost[b] = indexAtMost(index, bounds[b]);
+
+    for (int q = 0; q < queries; q++) {
+        if (lower[q] > upper[q]) {
+            out[q] = 0;
+            continue;
+        }
+        out[q] = atMost[findBound(bounds, m, upper[q])]
+               - atMost[findBound(bounds, m, (long long)lower[q] - 1)];
+    }
+    free(bounds);
+    free(atMost);
+}
@@ -0,0 +1,52 @@
+#ifndef FAIR_PAIRS_H
+#define FAIR_PAIRS_H
+
+/*
+   Fair-pair counting engine: the number of pairs i < j with
+   lower <= nums[i] + nums[j] <= upper.
+
+   Sorting is an LSD radix sort over the 32-bit keys with the sign bit
+   flipped (so negative values order correctly and no comparator is
+   involved). Counting is two monotone two-pointer sweeps over the sorted
+   array, pairs(sum <= upper) - pairs(sum < lower), O(n) after the sort.
+   Sums are formed in 64-bit, so extreme values cannot overflow.
+*/
+
+/* Sorts a[0..n) ascending; tmp must hold n ints. */
+void fairPairsSort(int* a, int n, int* tmp);
+
+/* Pairs i < j of an ascending array with a[i] + a[j] <= bound. */
+long long fairPairsAtMost(const int* sorted, int n, long long bound);
+
+/* Fair pairs of an ascending array. */
+long long fairPairsCountSorted(const int* sorted, int n, int lower, int upper);
+
+/* Fair pairs of an unsorted array; nums is not modified.
+   scratch must hold 2 * numsSize ints, or be NULL to allocate one. */
+long long countFairPairsRadix(const int* nums, int numsSize, int lower, int upper, int* scratch);
+
+/*
+   Prepared index for many range queries over the same nums: sort once,
+   then answer each (lower, upper) with two O(n) sweeps. When at most
+   half the values are distinct, the sweeps run over the distinct values
+   and their counts instead, O(d). A batch still costs one sweep per
+   distinct endpoint; it only saves the sweeps of endpoints that several
+   queries share.
+
+   If max(nums) - min(nums) <= histogramMaxRange, the index also stores
+   the full distribution of pair sums (histogram self-convolution plus
+   prefix sums), and every query becomes two table lookups.
+   Pass 0 (or less) to never build it, even when every value is equal.
+*/
+typedef struct FairPairsIndex FairPairsIndex;
+
+#define FAIR_PAIRS_HISTOGRAM_RANGE 4096
+
+FairPairsIndex* fairPairsPrepare(const int* nums, int numsSize, int histogramMaxRange);
+void fairPairsIndexFree(FairPairsIndex* index);
+int fairPairsHasHistogram(const FairPairsIndex* index);
+long long fairPairsQuery(const FairPairsIndex* index, int lower, int upper);
+void fairPairsQueryBatch(const FairPairsIndex* index, const int* lower, const int* upper,
+                         int queries, long long* out);
+
+#endif
@@ -2,7 +2,10 @@
 #include <stdlib.h>
 
 int compare(const void* a, const void* b) {
-    return (*(int*)a - *(int*)b);
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    // (x > y) - (x < y) instead of x - y, which overflows for extreme values
+    return (x > y) - (x < y);
 }
 
 long long countFairPairs(int* nums, int numsSize, int lower, int upper) {
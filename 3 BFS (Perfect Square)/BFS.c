@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <stdbool.h>
+
+/*
+   BFS from n over "subtract any square"; the level at which 0 is reached
+   is the answer. See "Math (Perfect square).md".
+*/
+int numSquares(int n) {
+    int* queue = (int*)malloc((n + 1) * sizeof(int));
+    bool* visited = (bool*)calloc(n + 1, sizeof(bool));
+    int front = 0, back = 0, level = 0;
+    queue[back++] = n;
+    visited[n] = true;
+    while (front < back) {
+        level++;
+        int levelEnd = back;
+        while (front < levelEnd) {
+            int cur = queue[front++];
+            for (int i = 1; i * i <= cur; i++) {
+                int next = cur - i * i;
+                if (next == 0) {
+                    free(queue);
+                    free(visited);
+                    return level;
+                }
+                if (!visited[next]) {
+                    visited[next] = true;
+                    queue[back++] = next;
+                }
+            }
+        }
+    }
+    free(queue);
+    free(visited);
+    return level;
+}
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "PerfectSquares.h"
+#include "BFS.c"
+
+/*
+   numSquares (BFS.c) against numSquaresMath and SquaresTable on random
+   queries.
+
+   Build:  gcc -O2 -pthread Benchmark.c PerfectSquares.c -o bench -lm
+   Run:    ./bench [queries] [bfsQueries]
+
+   Two rounds of `queries` (default 10^6) uniform queries: n <= 10^4
+   (the LeetCode bound) and n <= 10^8. The BFS runs on the first
+   `bfsQueries` of the first round only (default: all of them, about
+   40 s), and on none of the second. The table is built once per
+   round for its limit; the build is timed separately. Every answer is
+   checked against numSquaresMath.
+*/
+
+static void runRound(int limit, int queries, int bfsQueries) {
+    int* query = (int*)malloc(queries * sizeof(int));
+    unsigned char* expected = (unsigned char*)malloc(queries);
+    for (int q = 0; q < queries; q++) query[q] = 1 + (int)(nextRandom() % (unsigned int)limit);
+
+    printf("n <= %d\n", limit);
+    double t0 = nowSeconds();
+    long long sum = 0;
+    for (int q = 0; q < queries; q++) sum += expected[q] = (unsigned char)numSquaresMath(query[q]);
+    double t = nowSeconds() - t0;
+    printf("  %-12s %10d queries %10.1f ms %14.0f queries/s  (sum %lld)\n",
+           "math", queries, t * 1e3, queries / t, sum);
+
+    t0 = nowSeconds();
+    SquaresTable* table = squaresTableCreate(limit);
+    double build = nowSeconds() - t0;
+    int bad = 0;
+    t0 = nowSeconds();
+    sum = 0;
+    for (int q = 0; q < queries; q++) sum += squaresTableGet(table, query[q]);
+    t = nowSeconds() - t0;
+    for (int q = 0; q < queries; q++) bad += (squaresTableGet(table, query[q]) != expected[q]);
+    printf("  %-12s %10d queries %10.1f ms %14.0f queries/s  (sum %lld, build %.1f ms, %d KB)%s\n",
+           "table", queries, t * 1e3, queries / t, sum, build * 1e3, (limit + 1) / 1024,
+           bad ? "  (MISMATCH)" : "");
+    squaresTableFree(table);
+
+    if (bfsQueries > queries) bfsQueries = queries;
+    if (bfsQueries > 0) {
+        bad = 0;
+        sum = 0;
+        t0 = nowSeconds();
+        for (int q = 0; q < bfsQueries; q++) {
+            int r = numSquares(query[q]);
+            sum += r;
+            bad += (r != expected[q]);
+        }
+        t = nowSeconds() - t0;
+        printf("  %-12s %10d queries %10.1f ms %14.0f queries/s  (sum %lld)%s\n",
+               "BFS", bfsQueries, t * 1e3, bfsQueries / t, sum, bad ? "  (MISMATCH)" : "");
+    }
+    free(query);
+    free(expected);
+}
+
+int main(int argc, char** argv) {
+    int queries = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int bfsQueries = (argc > 2) ? atoi(argv[2]) : queries;
+    runRound(10000, queries, bfsQueries);
+    runRound(100000000, queries, 0);
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "PerfectSquares.h"
+
+// floor(sqrt(INT_MAX)); every composite int has a prime factor <= this.
+#define PRIME_LIMIT 46340
+
+/* Built once on first use; pthread_once makes that safe when the first
+   calls come from several threads. */
+static int* primes = NULL;
+static int primeCount = 0;
+static pthread_once_t primesOnce = PTHREAD_ONCE_INIT;
+
+static void buildPrimes(void) {
+    unsigned char* composite = (unsigned char*)calloc(PRIME_LIMIT + 1, 1);
+    int* list = (int*)malloc(PRIME_LIMIT * sizeof(int));
+    int count = 0;
+    for (int p = 2; p <= PRIME_LIMIT; p++) {
+        if (composite[p]) continue;
+        list[count++] = p;
+        for (long long q = (long long)p * p; q <= PRIME_LIMIT; q += p) composite[q] = 1;
+    }
+    free(composite);
+    primeCount = count;
+    primes = list;
+}
+
+static int isSquare(int n) {
+    int r = (int)sqrt((double)n);
+    while ((long long)r * r > n) r--;
+    while ((long long)(r + 1) * (r + 1) <= n) r++;
+    return (long long)r * r == n;
+}
+
+/* n > 0 is a sum of two squares iff each prime = 3 (mod 4) has an even
+   exponent. */
+static int isSumOfTwoSquares(int n) {
+    pthread_once(&primesOnce, buildPrimes);
+    while ((n & 1) == 0) n >>= 1;
+    for (int i = 1; i < primeCount; i++) {
+        int p = primes[i];
+        if (p > n / p) break;
+        if (n % p) continue;
+        int exponent = 0;
+        do {
+            n /= p;
+            exponent++;
+        } while (n % p == 0);
+        if ((p & 3) == 3 && (exponent & 1)) return 0;
+    }
+    // What is left is 1 or a prime with exponent 1.
+    return (n & 3) != 3;
+}
+
+int numSquaresMath(int n) {
+    if (n <= 0) return 0;
+    if (isSquare(n)) return 1;
+    int m = n;
+    while ((m & 3) == 0) m >>= 2;
+    if ((m & 7) == 7) return 4;
+    if (isSumOfTwoSquares(m)) return 2;
+    return 3;
+}
+
+SquaresTable* squaresTableCreate(int limit) {
+    SquaresTable* t = (SquaresTable*)malloc(sizeof(SquaresTable));
+    t->limit = limit;
+    t->answer = (unsigned char*)malloc((size_t)limit + 1);
+    unsigned char* answer = t->answer;
+    memset(answer, 3, (size_t)limit + 1);
+    answer[0] = 0;
+
+    // 4^a (8b + 7): one arithmetic progression per power of four.
+    for (long long scale = 1; 7 * scale <= limit; scale *= 4) {
+        for (long long v = 7 * scale; v <= limit; v += 8 * scale) answer[v] = 4;
+    }
+    // a^2 + b^2 with 1 <= a <= b.
+    for (long long a = 1; 2 * a * a <= limit; a++) {
+        for (long long b = a; a * a + b * b <= limit; b++) answer[a * a + b * b] = 2;
+    }
+    for (long long a = 1; a * a <= limit; a++) answer[a * a] = 1;
+    return t;
+}
+
+void squaresTableFree(SquaresTable* t) {
+    if (t == NULL) return;
+    free(t->answer);
+    free(t);
+}
@@ -0,0 +1,42 @@
+#ifndef PERFECT_SQUARES_H
+#define PERFECT_SQUARES_H
+
+/*
+   numSquares without the search. By Lagrange every n >= 1 needs at most
+   four squares, and which of 1..4 it is follows from number theory:
+
+   1  n is a perfect square;
+   4  n = 4^a (8b + 7) (Legendre's three-square theorem);
+   2  every prime p = 3 (mod 4) divides n an even number of times
+      (Fermat / sum of two squares theorem);
+   3  otherwise.
+
+   The Legendre test is O(1), so it runs before the factoring: a number
+   of that form is never a sum of two squares, so the order does not
+   change any answer. Factoring is trial division by the primes up to
+   46340, O(sqrt(n) / log n) divisions at worst.
+
+   For many queries below a fixed limit, SquaresTable holds every answer
+   in one byte. It is filled by sieving instead of per-value tests,
+   starting from 3 everywhere: the 4^a (8b + 7) progressions, then all
+   a^2 + b^2, then the squares. Later writes win, so the order matters:
+   a square such as 25 = 3^2 + 4^2 is also written as 2 and must be
+   overwritten with 1. (No 4^a (8b + 7) is a sum of two squares, so the
+   first two passes never collide.)
+*/
+
+int numSquaresMath(int n);
+
+typedef struct {
+    int limit;
+    unsigned char* answer;    // answer[0 .. limit]; answer[0] = 0
+} SquaresTable;
+
+SquaresTable* squaresTableCreate(int limit);
+void squaresTableFree(SquaresTable* t);
+
+static inline int squaresTableGet(const SquaresTable* t, int n) {
+    return t->answer[n];
+}
+
+#endif
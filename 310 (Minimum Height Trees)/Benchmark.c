@@ -0,0 +1,102 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "MinHeightTrees.h"
+#include "main.c"
+
+/*
+   findMinHeightTrees from main.c against mhtCentersTrim and
+   mhtCentersDiameter on large trees.
+
+   Build:  gcc -O2 -pthread Benchmark.c MinHeightTrees.c ../GRAPHS/CSRGraph.c -o bench
+   Run:    ./bench [nodes] [threads]
+
+   Trees (default 10^7 nodes, labels shuffled, edge order shuffled):
+   - random:      parent of i is uniform in [0, i)
+   - caterpillar: a path over half the nodes, every other node hangs off
+                  a random path node
+   - path:        a single path
+
+   main.c builds its own linked adjacency, so it is timed end to end; the
+   CSR variants are timed without csrBuild, which is reported once per
+   tree. All centers are checked against main.c.
+*/
+
+/* Edge rows point into flat; shape 0 = random, 1 = caterpillar, 2 = path. */
+static int** buildTree(int n, int shape, int* flat) {
+    int** edges = (int**)malloc((n > 1 ? n - 1 : 1) * sizeof(int*));
+    int* label = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) label[i] = i;
+    shuffle(label, n);
+    int spine = (shape == 1) ? (n + 1) / 2 : n;
+    for (int i = 1; i < n; i++) {
+        int p;
+        if (shape == 0) p = nextRandom() % i;
+        else if (i < spine) p = i - 1;
+        else p = nextRandom() % spine;
+        edges[i - 1] = flat + 2 * (i - 1);
+        edges[i - 1][0] = label[i];
+        edges[i - 1][1] = label[p];
+    }
+    for (int i = n - 2; i > 0; i--) {
+        int j = nextRandom() % (i + 1);
+        int* t = edges[i];
+        edges[i] = edges[j];
+        edges[j] = t;
+    }
+    free(label);
+    return edges;
+}
+
+static int sameCenters(const int* expected, int expectedSize, const int* c, int count) {
+    int lo = expected[0], hi = expected[expectedSize - 1];
+    if (lo > hi) {
+        int t = lo;
+        lo = hi;
+        hi = t;
+    }
+    return count == expectedSize && c[0] == lo && c[count - 1] == hi;
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int threads = (argc > 2) ? atoi(argv[2]) : 4;
+    const char* shapes[3] = { "random", "caterpillar", "path" };
+    int* flat = (int*)malloc(2 * (size_t)(n > 1 ? n - 1 : 1) * sizeof(int));
+
+    printf("nodes = %d, threads = %d\n", n, threads);
+    printf("%-12s %-16s %10s %14s\n", "tree", "method", "ms", "nodes/s");
+    for (int shape = 0; shape < 3; shape++) {
+        int** edges = buildTree(n, shape, flat);
+
+        double t0 = nowSeconds();
+        int expectedSize;
+        int* expected = findMinHeightTrees(n, edges, n - 1, NULL, &expectedSize);
+        double t = nowSeconds() - t0;
+        printf("%-12s %-16s %10.1f %14.0f\n", shapes[shape], "main.c", t * 1e3, n / t);
+
+        t0 = nowSeconds();
+        CSRGraph* g = csrBuild(n, edges, n - 1, CSR_UNDIRECTED);
+        t = nowSeconds() - t0;
+        printf("%-12s %-16s %10.1f %14.0f\n", shapes[shape], "csrBuild", t * 1e3, n / t);
+
+        for (int m = 0; m < 3; m++) {
+            int c[2], count;
+            const char* name = (m == 0) ? "trim 1 thread" : (m == 1) ? "trim threads" : "two BFS";
+            t0 = nowSeconds();
+            if (m == 0) count = mhtCentersTrim(g, 1, c);
+            else if (m == 1) count = mhtCentersTrim(g, threads, c);
+            else count = mhtCentersDiameter(g, c);
+            t = nowSeconds() - t0;
+            printf("%-12s %-16s %10.1f %14.0f%s\n", shapes[shape], name, t * 1e3, n / t,
+                   sameCenters(expected, expectedSize, c, count) ? "" : "  (MISMATCH)");
+        }
+
+        csrFree(g);
+        free(expected);
+        free(edges);
+    }
+    free(flat);
+    return 0;
+}
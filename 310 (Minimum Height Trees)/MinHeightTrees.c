@@ -0,0 +1,245 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "MinHeightTrees.h"
+
+/*
+   Shared state of one mhtCentersTrim call. queue[] holds the frontiers
+   back to back, as q does in main.c: the current layer is
+   queue[front .. back), the next one is appended at tail.
+*/
+typedef struct {
+    const CSRGraph* g;
+    atomic_int* degree;
+    int* queue;
+    atomic_int tail;
+    int front;
+    int back;
+    int remaining;      // vertices not yet trimmed
+    int threads;
+    pthread_barrier_t barrier;
+} Trim;
+
+typedef struct {
+    Trim* t;
+    int id;
+    int* local;         // leaves found by this worker in the current layer
+    pthread_t thread;
+} TrimWorker;
+
+/* Appends count leaves from a worker's buffer to the shared queue. */
+static void publish(Trim* t, const int* local, int count) {
+    if (count == 0) return;
+    int at = atomic_fetch_add_explicit(&t->tail, count, memory_order_relaxed);
+    memcpy(t->queue + at, local, count * sizeof(int));
+}
+
+/* Trims queue[begin .. end) concurrently with other workers. */
+static int trimSlice(Trim* t, int begin, int end, int* local) {
+    const CSRGraph* g = t->g;
+    int found = 0;
+    for (int i = begin; i < end; i++) {
+        int z = t->queue[i];
+        atomic_store_explicit(&t->degree[z], 0, memory_order_relaxed);
+        for (int j = g->offset[z]; j < g->offset[z + 1]; j++) {
+            int y = g->adj[j];
+            if (atomic_load_explicit(&t->degree[y], memory_order_relaxed) == 0) continue;
+            if (atomic_fetch_sub_explicit(&t->degree[y], 1, memory_order_relaxed) == 2) local[found++] = y;
+            break;
+        }
+    }
+    return found;
+}
+
+/* Finishes the peel on the calling thread; no other worker is running. */
+static void trimSerial(Trim* t) {
+    const CSRGraph* g = t->g;
+    atomic_int* degree = t->degree;
+    int* queue = t->queue;
+    int front = t->front, back = t->back;
+    int tail = atomic_load_explicit(&t->tail, memory_order_relaxed);
+    while (t->remaining > 2) {
+        t->remaining -= back - front;
+        for (int i = front; i < back; i++) {
+            int z = queue[i];
+            atomic_store_explicit(&degree[z], 0, memory_order_relaxed);
+            for (int j = g->offset[z]; j < g->offset[z + 1]; j++) {
+                int y = g->adj[j];
+                int d = atomic_load_explicit(&degree[y], memory_order_relaxed);
+                if (d == 0) continue;
+                atomic_store_explicit(&degree[y], d - 1, memory_order_relaxed);
+                if (d == 2) queue[tail++] = y;
+                break;
+            }
+        }
+        front = back;
+        back = tail;
+    }
+    t->front = front;
+    t->back = back;
+}
+
+static void sliceOf(int begin, int end, int id, int threads, int* lo, int* hi) {
+    long long size = end - begin;
+    *lo = begin + (int)(size * id / threads);
+    *hi = begin + (int)(size * (id + 1) / threads);
+}
+
+static void* trimWorker(void* arg) {
+    TrimWorker* w = (TrimWorker*)arg;
+    Trim* t = w->t;
+    const CSRGraph* g = t->g;
+    int lo, hi, found = 0;
+
+    // Layer 0: degrees and initial leaves over a slice of the vertices.
+    sliceOf(0, g->n, w->id, t->threads, &lo, &hi);
+    for (int v = lo; v < hi; v++) {
+        int d = csrDegree(g, v);
+        atomic_store_explicit(&t->degree[v], d, memory_order_relaxed);
+        if (d == 1) w->local[found++] = v;
+    }
+    publish(t, w->local, found);
+
+    while (true) {
+        // Worker 0 closes the layer between the two barriers.
+        pthread_barrier_wait(&t->barrier);
+        if (w->id == 0) {
+            t->front = t->back;
+            t->back = atomic_load_explicit(&t->tail, memory_order_relaxed);
+        }
+        pthread_barrier_wait(&t->barrier);
+        int size = t->back - t->front;
+        if (t->remaining <= 2 || size < MHT_PARALLEL_LAYER) break;
+        sliceOf(t->front, t->back, w->id, t->threads, &lo, &hi);
+        found = trimSlice(t, lo, hi, w->local);
+        publish(t, w->local, found);
+        pthread_barrier_wait(&t->barrier);
+        if (w->id == 0) t->remaining -= size;
+    }
+    return NULL;
+}
+
+static int sortedCenters(const int* v, int count, int centers[2]) {
+    centers[0] = v[0];
+    if (count == 2) {
+        centers[0] = v[0] < v[1] ? v[0] : v[1];
+        centers[1] = v[0] < v[1] ? v[1] : v[0];
+    }
+    return count;
+}
+
+int mhtCentersTrim(const CSRGraph* g, int threads, int centers[2]) {
+    int n = g->n;
+    if (n <= 2) {
+        centers[0] = 0;
+        centers[1] = 1;
+        return n;
+    }
+    if (threads < 1) threads = 1;
+
+    Trim t;
+    t.g = g;
+    t.degree = (atomic_int*)malloc(n * sizeof(atomic_int));
+    t.queue = (int*)malloc(n * sizeof(int));
+    atomic_init(&t.tail, 0);
+    t.front = 0;
+    t.back = 0;
+    t.remaining = n;
+    t.threads = threads;
+    pthread_barrier_init(&t.barrier, NULL, threads);
+
+    // Worker 0 runs on the calling thread. Each trimmed leaf frees at most
+    // one new leaf, so a worker's buffer needs one slice of the largest
+    // layer: ceil(n / threads), at most one more than its layer-0 slice.
+    TrimWorker* workers = (TrimWorker*)malloc(threads * sizeof(TrimWorker));
+    int* local = (int*)malloc(((size_t)n + threads) * sizeof(int));
+    for (int i = 0; i < threads; i++) {
+        int lo, hi;
+        sliceOf(0, n, i, threads, &lo, &hi);
+        workers[i].t = &t;
+        workers[i].id = i;
+        workers[i].local = local + lo + i;
+        if (i > 0) pthread_create(&workers[i].thread, NULL, trimWorker, &workers[i]);
+    }
+    trimWorker(&workers[0]);
+    for (int i = 1; i < threads; i++) pthread_join(workers[i].thread, NULL);
+
+    trimSerial(&t);
+    int count = sortedCenters(t.queue + t.front, t.back - t.front, centers);
+
+    pthread_barrier_destroy(&t.barrier);
+    free(local);
+    free(workers);
+    free(t.degree);
+    free(t.queue);
+    return count;
+}
+
+/* BFS from source; returns the last vertex dequeued (a farthest one) and
+   its distance in *distance. parent[] is filled when non-NULL. */
+static int farthestFrom(const CSRGraph* g, int source, int* queue, int* seen, int mark,
+                        int* parent, int* distance) {
+    int front = 0, back = 0, layerEnd = 1, depth = 0;
+    queue[back++] = source;
+    seen[source] = mark;
+    if (parent) parent[source] = -1;
+    while (true) {
+        int v = queue[front++];
+        for (int j = g->offset[v]; j < g->offset[v + 1]; j++) {
+            int y = g->adj[j];
+            if (seen[y] == mark) continue;
+            seen[y] = mark;
+            if (parent) parent[y] = v;
+            queue[back++] = y;
+        }
+        if (front == back) {
+            *distance = depth;
+            return v;
+        }
+        if (front == layerEnd) {
+            depth++;
+            layerEnd = back;
+        }
+    }
+}
+
+int mhtCentersDiameter(const CSRGraph* g, int centers[2]) {
+    int n = g->n;
+    if (n <= 2) {
+        centers[0] = 0;
+        centers[1] = 1;
+        return n;
+    }
+    int* queue = (int*)malloc(n * sizeof(int));
+    int* seen = (int*)calloc(n, sizeof(int));
+    int* parent = (int*)malloc(n * sizeof(int));
+    int distance;
+    int a = farthestFrom(g, 0, queue, seen, 1, NULL, &distance);
+    int b = farthestFrom(g, a, queue, seen, 2, parent, &distance);
+
+    // The path b -> a has distance edges; its middle is distance / 2
+    // steps from b, plus the next vertex when distance is odd.
+    int v = b;
+    for (int s = 0; s < distance / 2; s++) v = parent[v];
+    int mid[2] = { v, parent[v] };
+    int count = sortedCenters(mid, (distance & 1) ? 2 : 1, centers);
+
+    free(queue);
+    free(seen);
+    free(parent);
+    return count;
+}
+
+int* findMinHeightTreesParallel(int n, int** edges, int edgesSize, int* edgesColSize,
+                                int* returnSize, int threads) {
+    (void)edgesColSize;
+    CSRGraph* g = csrBuild(n, edges, edgesSize, CSR_UNDIRECTED);
+    int centers[2];
+    *returnSize = mhtCentersTrim(g, threads, centers);
+    int* result = (int*)malloc(*returnSize * sizeof(int));
+    memcpy(result, centers, *returnSize * sizeof(int));
+    csrFree(g);
+    return result;
+}
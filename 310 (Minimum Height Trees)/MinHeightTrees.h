@@ -0,0 +1,35 @@
+#ifndef MIN_HEIGHT_TREES_H
+#define MIN_HEIGHT_TREES_H
+
+#include "../GRAPHS/CSRGraph.h"
+
+/*
+   Minimum height tree roots (the centers of a tree) on a CSRGraph.
+   Both functions write the one or two centers to centers[], ascending,
+   and return how many there are. g must be an undirected tree.
+
+   mhtCentersTrim is the leaf-peeling of main.c on CSR adjacency. The
+   leaves of one layer form a frontier; trimming a leaf marks it removed
+   (degree 0) and decrements its single live neighbour, stopping the
+   neighbour scan there. A neighbour that reaches degree 1 joins the next
+   frontier. Layers never grow (each trimmed leaf frees at most one new
+   leaf), so the threads split the frontier and decrement with atomics
+   only while it holds at least MHT_PARALLEL_LAYER leaves; the tail of
+   the peel, which on path-like trees is almost all of it, runs on one
+   thread without atomics or barriers.
+
+   mhtCentersDiameter finds a longest path with two BFS passes (farthest
+   vertex from 0, then farthest from that) and returns its middle one or
+   two vertices.
+*/
+
+#define MHT_PARALLEL_LAYER (1 << 14)
+
+int mhtCentersTrim(const CSRGraph* g, int threads, int centers[2]);
+int mhtCentersDiameter(const CSRGraph* g, int centers[2]);
+
+/* Same contract as findMinHeightTrees in main.c, with a worker count. */
+int* findMinHeightTreesParallel(int n, int** edges, int edgesSize, int* edgesColSize,
+                                int* returnSize, int threads);
+
+#endif
@@ -0,0 +1,44 @@
+#include <stdlib.h>
+
+int* findMinHeightTrees(int n, int** edges, int edgesSize, int* edgesColSize, int* returnSize) {
+    (void)edgesColSize;
+    if (n == 1) {
+        int* r = malloc(sizeof(int));
+        r[0] = 0;
+        *returnSize = 1;
+        return r;
+    }
+    int* d = calloc(n, sizeof(int));
+    int* a = malloc(edgesSize * 2 * sizeof(int));
+    int* h = malloc(n * sizeof(int));
+    int* x = malloc(edgesSize * 2 * sizeof(int));
+    for (int i = 0; i < n; i++) h[i] = -1;
+    int p = 0;
+    for (int i = 0; i < edgesSize; i++) {
+        int u = edges[i][0], v = edges[i][1];
+        a[p] = v; x[p] = h[u]; h[u] = p++;
+        a[p] = u; x[p] = h[v]; h[v] = p++;
+        d[u]++; d[v]++;
+    }
+    int* q = malloc(n * sizeof(int));
+    int f = 0, b = 0;
+    for (int i = 0; i < n; i++) if (d[i] == 1) q[b++] = i;
+    int r = n;
+    while (r > 2) {
+        int s = b - f;
+        r -= s;
+        while (s--) {
+            int z = q[f++];
+            for (int j = h[z]; j != -1; j = x[j]) {
+                int y = a[j];
+                if (--d[y] == 1) q[b++] = y;
+            }
+        }
+    }
+    int t = b - f;
+    int* o = malloc(t * sizeof(int));
+    for (int i = 0; i < t; i++) o[i] = q[f + i];
+    *returnSize = t;
+    free(d); free(a); free(h); free(x); free(q);
+    return o;
+}
@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "PriorityQueue.h"
+#include "BatchQuery.h"
+#include "../GRAPHS/CSRGraph.h"
+
+// Queries handed to a worker at a time.
+#define BATCH_CHUNK 64
+
+/*
+   Per-worker scratch. slot[v].dist is only meaningful when
+   slot[v].stamp == gen; starting a query bumps gen, which "clears" every
+   distance at once. Stamp and distance share a cache line.
+*/
+typedef struct {
+    int dist;
+    unsigned int stamp;
+} Slot;
+
+typedef struct {
+    Slot* slot;
+    unsigned int gen;
+    PriorityQueue* heap;
+} Scratch;
+
+typedef struct {
+    BatchExecutor* ex;
+    Scratch scratch;
+    pthread_t thread;
+} Worker;
+
+struct BatchExecutor {
+    int n;
+    CSRGraph* graph;    // frozen adjacency, shared read-only by all workers
+
+    int threads;
+    Worker* workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t finished;
+    unsigned long long round;   // bumped once per batch
+    int busy;                   // workers still inside the current batch
+    bool stop;
+
+    // The batch being executed.
+    int** query;
+    int querySize;
+    int* answers;
+    atomic_int next;
+};
+
+static void scratchBegin(Scratch* sc, int n) {
+    if (++sc->gen == 0) {
+        for (int v = 0; v < n; v++) sc->slot[v].stamp = 0;
+        sc->gen = 1;
+    }
+    pqReset(sc->heap);
+}
+
+// Unvisited vertices read as -1, exactly like the dist array in O1.c.
+static inline int readDist(const Scratch* sc, int v) {
+    return (sc->slot[v].stamp == sc->gen) ? sc->slot[v].dist : -1;
+}
+
+static int runQuery(const BatchExecutor* ex, Scratch* sc, int s, int t) {
+    scratchBegin(sc, ex->n);
+
+    // Start cost is all bits set; like O1.c it is not recorded in dist.
+    pqPush(sc->heap, 0xFFFFFFFFu, s);
+
+    while (!pqEmpty(sc->heap)) {
+        PQItem top = pqPop(sc->heap);
+        int curCost = (int)top.key;
+        int node = top.node;
+
+        if (readDist(sc, node) != curCost) continue;
+        if (node == t) break;
+
+        const CSRGraph* g = ex->graph;
+        for (int i = g->offset[node]; i < g->offset[node + 1]; i++) {
+            int nxt = g->adj[i];
+            int newCost = curCost & g->weight[i];
+            int old = readDist(sc, nxt);
+            if (old == -1 || newCost < old) {
+                sc->slot[nxt].dist = newCost;
+                sc->slot[nxt].stamp = sc->gen;
+                pqPush(sc->heap, (unsigned int)newCost, nxt);
+            }
+        }
+    }
+    return readDist(sc, t);
+}
+
+static void* workerMain(void* arg) {
+    Worker* w = (Worker*)arg;
+    BatchExecutor* ex = w->ex;
+    unsigned long long seen = 0;
+
+    while (true) {
+        pthread_mutex_lock(&ex->lock);
+        while (!ex->stop && ex->round == seen) {
+            pthread_cond_wait(&ex->start, &ex->lock);
+        }
+        if (ex->stop) {
+            pthread_mutex_unlock(&ex->lock);
+            return NULL;
+        }
+        seen = ex->round;
+        pthread_mutex_unlock(&ex->lock);
+
+        while (true) {
+            int begin = atomic_fetch_add(&ex->next, BATCH_CHUNK);
+            if (begin >= ex->querySize) break;
+            int end = begin + BATCH_CHUNK;
+            if (end > ex->querySize) end = ex->querySize;
+            for (int q = begin; q < end; q++) {
+                ex->answers[q] = runQuery(ex, &w->scratch, ex->query[q][0], ex->query[q][1]);
+            }
+        }
+
+        pthread_mutex_lock(&ex->lock);
+        if (--ex->busy == 0) pthread_cond_signal(&ex->finished);
+        pthread_mutex_unlock(&ex->lock);
+    }
+}
+
+BatchExecutor* batchCreate(int n, int** edges, int edgesSize, int threads) {
+    BatchExecutor* ex = (BatchExecutor*)calloc(1, sizeof(BatchExecutor));
+    if (threads < 1) threads = 1;
+    ex->n = n;
+    ex->threads = threads;
+
+    // Arcs of a vertex keep edge-list order, so relaxations happen in the
+    // same order as in O1.c.
+    ex->graph = csrBuild(n, edges, edgesSize, CSR_UNDIRECTED | CSR_WEIGHTED);
+
+    pthread_mutex_init(&ex->lock, NULL);
+    pthread_cond_init(&ex->start, NULL);
+    pthread_cond_init(&ex->finished, NULL);
+
+    ex->workers = (Worker*)calloc(threads, sizeof(Worker));
+    for (int i = 0; i < threads; i++) {
+        Worker* w = &ex->workers[i];
+        w->ex = ex;
+        w->scratch.slot = (Slot*)calloc(n, sizeof(Slot));
+        w->scratch.heap = pqCreate(PQ_BINARY, n, n);
+        pthread_create(&w->thread, NULL, workerMain, w);
+    }
+    return ex;
+}
+
+void batchRun(BatchExecutor* ex, int** query, int querySize, int* answers) {
+    pthread_mutex_lock(&ex->lock);
+    ex->query = query;
+    ex->querySize = querySize;
+    ex->answers = answers;
+    atomic_store(&ex->next, 0);
+    ex->busy = ex->threads;
+    ex->round++;
+    pthread_cond_broadcast(&ex->start);
+    while (ex->busy > 0) {
+        pthread_cond_wait(&ex->finished, &ex->lock);
+    }
+    pthread_mutex_unlock(&ex->lock);
+}
+
+void batchFree(BatchExecutor* ex) {
+    if (ex == NULL) return;
+    pthread_mutex_lock(&ex->lock);
+    ex->stop = true;
+    pthread_cond_broadcast(&ex->start);
+    pthread_mutex_unlock(&ex->lock);
+
+    for (int i = 0; i < ex->threads; i++) {
+        Worker* w = &ex->workers[i];
+        pthread_join(w->thread, NULL);
+        free(w->scratch.slot);
+        pqFree(w->scratch.heap);
+    }
+    pthread_mutex_destroy(&ex->lock);
+    pthread_cond_destroy(&ex->start);
+    pthread_cond_destroy(&ex->finished);
+    free(ex->workers);
+    csrFree(ex->graph);
+    free(ex);
+}
+
+int* minimumCostBatch(int n, int** edges, int edgesSize,
+                      int* edgesColSize,
+                      int** query, int querySize,
+                      int* queryColSize,
+                      int* returnSize, int threads)
+{
+    (void)edgesColSize;
+    (void)queryColSize;
+    int* ans = (int*)malloc(querySize * sizeof(int));
+    *returnSize = querySize;
+
+    BatchExecutor* ex = batchCreate(n, edges, edgesSize, threads);
+    batchRun(ex, query, querySize, ans);
+    batchFree(ex);
+    return ans;
+}
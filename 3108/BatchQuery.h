@@ -0,0 +1,31 @@
+#ifndef BATCH_QUERY_H
+#define BATCH_QUERY_H
+
+/*
+   Batch executor for the minimumCost queries of O1.c.
+
+   batchCreate freezes the edge list into one contiguous CSR graph and
+   starts a pool of worker threads. Each worker owns a scratch block
+   (distances with generation stamps plus a priority queue) that is reused
+   for every query it runs, so nothing is allocated or re-initialised per
+   query. batchRun hands a batch of queries to the pool in small chunks and
+   blocks until every answer is written; the same executor can run any
+   number of batches.
+
+   Answers are identical to minimumCost in O1.c.
+*/
+
+typedef struct BatchExecutor BatchExecutor;
+
+BatchExecutor* batchCreate(int n, int** edges, int edgesSize, int threads);
+void batchRun(BatchExecutor* ex, int** query, int querySize, int* answers);
+void batchFree(BatchExecutor* ex);
+
+/* Same contract as minimumCost, with an explicit worker count. */
+int* minimumCostBatch(int n, int** edges, int edgesSize,
+                      int* edgesColSize,
+                      int** query, int querySize,
+                      int* queryColSize,
+                      int* returnSize, int threads);
+
+#endif
@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../BENCH/BenchUtil.h"
+#include "BatchQuery.h"
+
+/*
+   Throughput of minimumCostBatch against the serial minimumCost in O1.c.
+
+   Build:  gcc -O2 -pthread BatchQueryBenchmark.c O1.c BatchQuery.c PriorityQueue.c \
+               ../GRAPHS/CSRGraph.c -o batchbench
+   Run:    ./batchbench [n] [edges] [queries] [maxThreads]
+
+   Every run checks that the batch answers match the serial ones.
+*/
+
+int* minimumCost(int n, int** edges, int edgesSize,
+                 int* edgesColSize,
+                 int** query, int querySize,
+                 int* queryColSize,
+                 int* returnSize);
+
+static int** makeRows(int rows, int cols) {
+    int** m = (int**)malloc(rows * sizeof(int*));
+    int* data = (int*)malloc((size_t)rows * cols * sizeof(int));
+    for (int i = 0; i < rows; i++) m[i] = data + (size_t)i * cols;
+    return m;
+}
+
+static void freeRows(int** m) {
+    free(m[0]);
+    free(m);
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 2000;
+    int m = (argc > 2) ? atoi(argv[2]) : 4000;
+    int q = (argc > 3) ? atoi(argv[3]) : 100000;
+    int maxThreads = (argc > 4) ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (maxThreads < 1) maxThreads = 1;
+
+    srand(3108);
+    int** edges = makeRows(m, 3);
+    for (int i = 0; i < m; i++) {
+        edges[i][0] = rand() % n;
+        edges[i][1] = rand() % n;
+        edges[i][2] = rand() % 100001;
+    }
+    int** query = makeRows(q, 2);
+    for (int i = 0; i < q; i++) {
+        query[i][0] = rand() % n;
+        query[i][1] = rand() % n;
+    }
+
+    printf("n = %d, edges = %d, queries = %d\n", n, m, q);
+
+    int size;
+    double t0 = nowSeconds();
+    int* expected = minimumCost(n, edges, m, NULL, query, q, NULL, &size);
+    double serial = nowSeconds() - t0;
+    printf("%-14s %10.3f s %12.0f queries/s\n", "serial O1.c", serial, q / serial);
+
+    for (int threads = 1; ; threads = (threads * 2 < maxThreads) ? threads * 2 : maxThreads) {
+        t0 = nowSeconds();
+        int* got = minimumCostBatch(n, edges, m, NULL, query, q, NULL, &size, threads);
+        double t = nowSeconds() - t0;
+
+        int mismatches = 0;
+        for (int i = 0; i < q; i++) {
+            if (got[i] != expected[i]) mismatches++;
+        }
+        printf("batch x%-7d %10.3f s %12.0f queries/s  speedup %.2fx%s\n",
+               threads, t, q / t, serial / t, mismatches ? "  (MISMATCH)" : "");
+        free(got);
+        if (threads == maxThreads) break;
+    }
+
+    free(expected);
+    freeRows(edges);
+    freeRows(query);
+    return 0;
+}
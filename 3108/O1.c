@@ -2,107 +2,23 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <stdbool.h>
+#include "PriorityQueue.h"
+#include "../GRAPHS/CSRGraph.h"
 
 /*
-   We'll store the graph as an adjacency list:
-   adj[v] = list of (neighbor, weight).
+   We'll store the graph in CSR form (see GRAPHS/CSRGraph.h):
+   the (neighbor, weight) pairs of v are
+   adj->adj[i], adj->weight[i] for i in [adj->offset[v], adj->offset[v+1]).
 */
-typedef struct {
-    int to;
-    int w;
-} Edge;
-
-typedef struct {
-    Edge* data;
-    int size;
-    int capacity;
-} Vec;
-
-void vecInit(Vec* vec, int cap) {
-    vec->data = (Edge*)malloc(cap * sizeof(Edge));
-    vec->size = 0;
-    vec->capacity = cap;
-}
-void vecPush(Vec* vec, int to, int w) {
-    if (vec->size == vec->capacity) {
-        vec->capacity *= 2;
-        vec->data = (Edge*)realloc(vec->data, vec->capacity * sizeof(Edge));
-    }
-    vec->data[vec->size].to = to;
-    vec->data[vec->size].w = w;
-    vec->size++;
-}
-
-/* Min-heap for (cost, node). */
-typedef struct {
-    int cost;
-    int node;
-} HeapItem;
-
-void swap(HeapItem* a, HeapItem* b) {
-    HeapItem tmp = *a;
-    *a = *b;
-    *b = tmp;
-}
-
-typedef struct {
-    HeapItem* arr;
-    int size;
-    int capacity;
-} MinHeap;
-
-MinHeap* createMinHeap(int cap) {
-    MinHeap* h = (MinHeap*)malloc(sizeof(MinHeap));
-    h->arr = (HeapItem*)malloc(cap * sizeof(HeapItem));
-    h->size = 0;
-    h->capacity = cap;
-    return h;
-}
-
-void heapPush(MinHeap* h, int cost, int node) {
-    if (h->size == h->capacity) {
-        h->capacity *= 2;
-        h->arr = (HeapItem*)realloc(h->arr, h->capacity * sizeof(HeapItem));
-    }
-    int idx = h->size++;
-    h->arr[idx].cost = cost;
-    h->arr[idx].node = node;
-    // bubble up
-    while (idx > 0) {
-        int parent = (idx - 1) / 2;
-        if (h->arr[parent].cost <= h->arr[idx].cost) break;
-        swap(&h->arr[parent], &h->arr[idx]);
-        idx = parent;
-    }
-}
-
-HeapItem heapPop(MinHeap* h) {
-    HeapItem ret = h->arr[0];
-    h->size--;
-    if (h->size > 0) {
-        h->arr[0] = h->arr[h->size];
-        // bubble down
-        int idx = 0;
-        while (true) {
-            int left = 2*idx + 1, right = 2*idx + 2;
-            int smallest = idx;
-            if (left < h->size && h->arr[left].cost < h->arr[smallest].cost) {
-                smallest = left;
-            }
-            if (right < h->size && h->arr[right].cost < h->arr[smallest].cost) {
-                smallest = right;
-            }
-            if (smallest == idx) break;
-            swap(&h->arr[idx], &h->arr[smallest]);
-            idx = smallest;
-        }
-    }
-    return ret;
-}
 
-bool heapEmpty(MinHeap* h) {
-    return (h->size == 0);
-}
+/*
+   Priority queue backend, see PriorityQueue.h.
+   Costs only shrink along an edge (cost & w), so PQ_RADIX (monotone keys)
+   does not apply here; any of the other three backends works.
+*/
+#ifndef PQ_BACKEND
+#define PQ_BACKEND PQ_BINARY
+#endif
 
 /**
  * n: number of vertices
@@ -119,25 +35,17 @@ int* minimumCost(int n, int** edges, int edgesSize,
                  int* queryColSize,
                  int* returnSize)
 {
-    // Build adjacency list.
-    // First allocate an array of Vec (one Vec per vertex).
-    Vec* adj = (Vec*)malloc(n * sizeof(Vec));
-    for(int i=0; i<n; i++){
-        vecInit(&adj[i], 2);
-    }
-    for(int i=0; i<edgesSize; i++){
-        int u = edges[i][0];
-        int v = edges[i][1];
-        int w = edges[i][2];
-        vecPush(&adj[u], v, w);
-        vecPush(&adj[v], u, w);  // undirected
-    }
+    // Build adjacency (undirected, weighted) in one allocation.
+    CSRGraph* adj = csrBuild(n, edges, edgesSize, CSR_UNDIRECTED | CSR_WEIGHTED);
 
     // We'll answer each query by running a D'Johnson-like
     // bitwise-AND "Dijkstra" from s to t.
     int* ans = (int*)malloc(querySize * sizeof(int));
     *returnSize = querySize;
 
+    // One queue for all queries; pqReset empties it without freeing.
+    PriorityQueue* heap = pqCreate(PQ_BACKEND, n, n);
+
     for(int q=0; q<querySize; q++){
         int s = query[q][0];
         int t = query[q][1];
@@ -149,19 +57,19 @@ int* minimumCost(int n, int** edges, int edgesSize,
             dist[i] = -1;
         }
 
-        // Use a min-heap keyed by the *numerical value* of the AND-cost
-        MinHeap* heap = createMinHeap(n);
+        // Min-queue keyed by the *numerical value* of the AND-cost
+        pqReset(heap);
 
         // Start with cost = all bits set
         const int INF_COST = 0x7fffffff; // or 0xffffffff if you prefer
         const int START_COST = 0xffffffff;
 
         dist[s] = START_COST;
-        heapPush(heap, dist[s], s);
+        pqPush(heap, (unsigned int)dist[s], s);
 
-        while(!heapEmpty(heap)) {
-            HeapItem top = heapPop(heap);
-            int curCost = top.cost;
+        while(!pqEmpty(heap)) {
+            PQItem top = pqPop(heap);
+            int curCost = (int)top.key;
             int node = top.node;
 
             // If this is stale (we have found a smaller cost for "node") skip
@@ -173,31 +81,28 @@ int* minimumCost(int n, int** edges, int edgesSize,
             }
 
             // Relax edges
-            for(int i=0; i<adj[node].size; i++){
-                int nxt = adj[node].data[i].to;
-                int w   = adj[node].data[i].w;
+            for(int i=adj->offset[node]; i<adj->offset[node+1]; i++){
+                int nxt = adj->adj[i];
+                int w   = adj->weight[i];
                 // newCost = current AND w
                 int newCost = curCost & w;
                 if (dist[nxt] == -1 || newCost < dist[nxt]) {
                     dist[nxt] = newCost;
-                    heapPush(heap, newCost, nxt);
+                    pqDecreaseKey(heap, (unsigned int)newCost, nxt);
                 }
             }
         }
 
         int answer = dist[t]; // might be -1 if never updated
-        free(heap->arr);
-        free(heap);
 
         ans[q] = answer;
         free(dist);
     }
 
-    // Free adjacency list
-    for(int i=0; i<n; i++){
-        free(adj[i].data);
-    }
-    free(adj);
+    pqFree(heap);
+
+    // Free adjacency
+    csrFree(adj);
 
     return ans;
 }
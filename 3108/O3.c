@@ -2,63 +2,15 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <stdbool.h>
+#include "PriorityQueue.h"
+#include "../GRAPHS/CSRGraph.h"
 
-// A structure to store adjacency info
-typedef struct {
-    int v;       // neighbor
-    int weight;  // edge weight
-} Edge;
-
-// Min-heap (priority queue) node
-typedef struct {
-    int node;
-    unsigned int cost; // we store bitwise-AND cost as an unsigned int
-} PQItem;
-
-// A simple min-heap comparison
-int comparePQ(const void *a, const void *b) {
-    PQItem *x = (PQItem*)a;
-    PQItem *y = (PQItem*)b;
-    if (x->cost < y->cost) return -1;
-    if (x->cost > y->cost) return 1;
-    return 0;
-}
-
-// A simple dynamic array-based min-heap for demonstration
-// (In production code, you'd use a more efficient data structure.)
-typedef struct {
-    PQItem *data;
-    int size;
-    int capacity;
-} MinHeap;
-
-MinHeap* createHeap(int capacity) {
-    MinHeap* h = (MinHeap*)malloc(sizeof(MinHeap));
-    h->data = (PQItem*)malloc(sizeof(PQItem)*capacity);
-    h->size = 0;
-    h->capacity = capacity;
-    return h;
-}
-void pushHeap(MinHeap* h, PQItem val) {
-    // Insert at end, then "bubble up" by re-sorting.
-    if (h->size < h->capacity) {
-        h->data[h->size++] = val;
-        // For simplicity, just qsort after each push
-        qsort(h->data, h->size, sizeof(PQItem), comparePQ);
-    }
-}
-PQItem popHeap(MinHeap* h) {
-    // Pop from front (smallest), then shift everything
-    PQItem top = h->data[0];
-    for(int i=1; i<h->size; i++){
-        h->data[i-1] = h->data[i];
-    }
-    h->size--;
-    return top;
-}
-bool emptyHeap(MinHeap* h) {
-    return (h->size == 0);
-}
+// Priority queue backend, see PriorityQueue.h.
+// AND-costs never grow along a path, so the monotone PQ_RADIX backend
+// cannot be used here; PQ_BINARY, PQ_FOURARY and PQ_PAIRING all work.
+#ifndef PQ_BACKEND
+#define PQ_BACKEND PQ_BINARY
+#endif
 
 // Solve function
 int* minimumCost(int n, int** edges, int edgesSize, int* edgesColSize,
@@ -67,33 +19,11 @@ int* minimumCost(int n, int** edges, int edgesSize, int* edgesColSize,
     *returnSize = querySize;
     int* answer = (int*)malloc(sizeof(int)*querySize);
 
-    // Build adjacency list
-    // First, count how many edges per node
-    int* deg = (int*)calloc(n, sizeof(int));
-    for(int i=0; i<edgesSize; i++){
-        int u = edges[i][0];
-        int v = edges[i][1];
-        deg[u]++;
-        deg[v]++;
-    }
-    // Allocate adjacency
-    Edge** graph = (Edge**)malloc(sizeof(Edge*)*n);
-    for(int i=0; i<n; i++){
-        graph[i] = (Edge*)malloc(sizeof(Edge)*deg[i]);
-        deg[i] = 0; // reuse as index
-    }
-    // Fill adjacency
-    for(int i=0; i<edgesSize; i++){
-        int u = edges[i][0];
-        int v = edges[i][1];
-        int w = edges[i][2];
-        graph[u][deg[u]].v = v;
-        graph[u][deg[u]].weight = w;
-        deg[u]++;
-        graph[v][deg[v]].v = u;
-        graph[v][deg[v]].weight = w;
-        deg[v]++;
-    }
+    // Build adjacency list (CSR, see GRAPHS/CSRGraph.h)
+    CSRGraph* graph = csrBuild(n, edges, edgesSize, CSR_UNDIRECTED | CSR_WEIGHTED);
+
+    // Min-heap shared by all queries, emptied with pqReset
+    PriorityQueue* pq = pqCreate(PQ_BACKEND, n*2, n); // rough capacity
 
     // For each query, run the "Dijkstra" that propagates bitwise-AND costs
     for(int i=0; i<querySize; i++){
@@ -114,19 +44,16 @@ int* minimumCost(int n, int** edges, int edgesSize, int* edgesColSize,
         }
         dist[s] = 0xFFFFFFFF;
 
-        // Min-heap
-        MinHeap* pq = createHeap(n*2); // rough capacity
-
         // push start
-        PQItem startItem = {s, dist[s]};
-        pushHeap(pq, startItem);
+        pqReset(pq);
+        pqPush(pq, dist[s], s);
 
         int ans = -1;
 
-        while(!emptyHeap(pq)) {
-            PQItem top = popHeap(pq);
+        while(!pqEmpty(pq)) {
+            PQItem top = pqPop(pq);
             int u = top.node;
-            unsigned int costSoFar = top.cost;
+            unsigned int costSoFar = top.key;
 
             // If we already found a better cost for u, skip
             if(costSoFar > dist[u]) continue;
@@ -138,31 +65,25 @@ int* minimumCost(int n, int** edges, int edgesSize, int* edgesColSize,
             }
 
             // Relax edges
-            for(int eidx=0; eidx<deg[u]; eidx++){
-                int v = graph[u][eidx].v;
-                unsigned int w = (unsigned int)graph[u][eidx].weight;
+            for(int eidx=graph->offset[u]; eidx<graph->offset[u+1]; eidx++){
+                int v = graph->adj[eidx];
+                unsigned int w = (unsigned int)graph->weight[eidx];
                 unsigned int newCost = costSoFar & w;
                 if(newCost < dist[v]) {
                     dist[v] = newCost;
-                    PQItem newItem = {v, newCost};
-                    pushHeap(pq, newItem);
+                    pqDecreaseKey(pq, newCost, v);
                 }
             }
         }
 
-        free(pq->data);
-        free(pq);
         free(dist);
 
         answer[i] = ans;
     }
 
     // Cleanup
-    for(int i=0; i<n; i++){
-        free(graph[i]);
-    }
-    free(graph);
-    free(deg);
+    pqFree(pq);
+    csrFree(graph);
 
     return answer;
 }
@@ -0,0 +1,300 @@
+#include <stdlib.h>
+#include <string.h>
+#include "PriorityQueue.h"
+
+#define RADIX_BUCKETS 33
+
+/* Pairing-heap slot, indexed by node id.
+   prev is the parent for a leftmost child, otherwise the left sibling. */
+typedef struct {
+    unsigned int key;
+    int child;
+    int sibling;
+    int prev;
+} PairNode;
+
+typedef struct {
+    PQItem* items;
+    int size;
+    int capacity;
+} RadixBucket;
+
+struct PriorityQueue {
+    PQKind kind;
+    int size;
+
+    /* PQ_BINARY / PQ_FOURARY */
+    PQItem* heap;
+    int capacity;
+    int arity;
+
+    /* PQ_PAIRING */
+    PairNode* pairs;
+    unsigned int* stamp;   // stamp[v] == gen  <=>  v is queued
+    unsigned int gen;
+    int* scratch;          // child list while merging pairs
+    int root;
+    int nodeCount;
+
+    /* PQ_RADIX */
+    RadixBucket buckets[RADIX_BUCKETS];
+    unsigned int last;
+};
+
+PriorityQueue* pqCreate(PQKind kind, int capacity, int nodeCount) {
+    PriorityQueue* pq = (PriorityQueue*)calloc(1, sizeof(PriorityQueue));
+    if (capacity < 1) capacity = 1;
+    pq->kind = kind;
+    pq->capacity = capacity;
+    pq->nodeCount = nodeCount;
+    pq->root = -1;
+
+    switch (kind) {
+        case PQ_BINARY:
+        case PQ_FOURARY:
+            pq->arity = (kind == PQ_BINARY) ? 2 : 4;
+            pq->heap = (PQItem*)malloc(capacity * sizeof(PQItem));
+            break;
+        case PQ_PAIRING:
+            pq->pairs = (PairNode*)malloc(nodeCount * sizeof(PairNode));
+            pq->stamp = (unsigned int*)calloc(nodeCount, sizeof(unsigned int));
+            pq->scratch = (int*)malloc(nodeCount * sizeof(int));
+            pq->gen = 1;
+            break;
+        case PQ_RADIX: {
+            // Most entries end up in the low buckets; the rest start small.
+            for (int b = 0; b < RADIX_BUCKETS; b++) {
+                int cap = (b == 0) ? capacity : 16;
+                pq->buckets[b].items = (PQItem*)malloc(cap * sizeof(PQItem));
+                pq->buckets[b].capacity = cap;
+            }
+            break;
+        }
+    }
+    return pq;
+}
+
+void pqFree(PriorityQueue* pq) {
+    if (pq == NULL) return;
+    free(pq->heap);
+    free(pq->pairs);
+    free(pq->stamp);
+    free(pq->scratch);
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        free(pq->buckets[b].items);
+    }
+    free(pq);
+}
+
+void pqReset(PriorityQueue* pq) {
+    pq->size = 0;
+    pq->root = -1;
+    pq->last = 0;
+    if (pq->kind == PQ_PAIRING) {
+        // Bumping the generation forgets every queued node at once.
+        if (++pq->gen == 0) {
+            memset(pq->stamp, 0, pq->nodeCount * sizeof(unsigned int));
+            pq->gen = 1;
+        }
+    } else if (pq->kind == PQ_RADIX) {
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            pq->buckets[b].size = 0;
+        }
+    }
+}
+
+bool pqEmpty(const PriorityQueue* pq) {
+    return (pq->size == 0);
+}
+
+int pqSize(const PriorityQueue* pq) {
+    return pq->size;
+}
+
+PQKind pqKind(const PriorityQueue* pq) {
+    return pq->kind;
+}
+
+/* ---------- implicit d-ary heap ---------- */
+
+static void daryPush(PriorityQueue* pq, unsigned int key, int node) {
+    if (pq->size == pq->capacity) {
+        pq->capacity *= 2;
+        pq->heap = (PQItem*)realloc(pq->heap, pq->capacity * sizeof(PQItem));
+    }
+    PQItem* h = pq->heap;
+    int d = pq->arity;
+    int idx = pq->size++;
+    // Move parents down instead of swapping, then drop the item in place.
+    while (idx > 0) {
+        int parent = (idx - 1) / d;
+        if (h[parent].key <= key) break;
+        h[idx] = h[parent];
+        idx = parent;
+    }
+    h[idx].key = key;
+    h[idx].node = node;
+}
+
+static PQItem daryPop(PriorityQueue* pq) {
+    PQItem* h = pq->heap;
+    PQItem ret = h[0];
+    int n = --pq->size;
+    if (n > 0) {
+        PQItem moving = h[n];
+        int d = pq->arity;
+        int idx = 0;
+        while (true) {
+            int first = d * idx + 1;
+            if (first >= n) break;
+            int last = first + d;
+            if (last > n) last = n;
+            int best = first;
+            for (int c = first + 1; c < last; c++) {
+                if (h[c].key < h[best].key) best = c;
+            }
+            if (h[best].key >= moving.key) break;
+            h[idx] = h[best];
+            idx = best;
+        }
+        h[idx] = moving;
+    }
+    return ret;
+}
+
+/* ---------- pairing heap ---------- */
+
+static int pairMeld(PairNode* p, int a, int b) {
+    if (a < 0) return b;
+    if (b < 0) return a;
+    if (p[b].key < p[a].key) {
+        int t = a; a = b; b = t;
+    }
+    // b becomes the leftmost child of a.
+    p[b].sibling = p[a].child;
+    if (p[a].child >= 0) p[p[a].child].prev = b;
+    p[b].prev = a;
+    p[a].child = b;
+    return a;
+}
+
+static void pairingPush(PriorityQueue* pq, unsigned int key, int node) {
+    PairNode* p = pq->pairs;
+    if (pq->stamp[node] == pq->gen) {
+        if (key >= p[node].key) return;
+        p[node].key = key;
+        if (node == pq->root) return;
+        // Cut the node (with its subtree) out and meld it with the root.
+        int prev = p[node].prev;
+        if (p[prev].child == node) p[prev].child = p[node].sibling;
+        else p[prev].sibling = p[node].sibling;
+        if (p[node].sibling >= 0) p[p[node].sibling].prev = prev;
+        p[node].sibling = -1;
+        p[node].prev = -1;
+        pq->root = pairMeld(p, pq->root, node);
+        return;
+    }
+    pq->stamp[node] = pq->gen;
+    p[node].key = key;
+    p[node].child = -1;
+    p[node].sibling = -1;
+    p[node].prev = -1;
+    pq->root = pairMeld(p, pq->root, node);
+    pq->size++;
+}
+
+static PQItem pairingPop(PriorityQueue* pq) {
+    PairNode* p = pq->pairs;
+    int r = pq->root;
+    PQItem ret = { p[r].key, r };
+    pq->stamp[r] = 0;
+    pq->size--;
+
+    // Two-pass merge: meld neighbours left to right, then fold right to left.
+    int count = 0;
+    for (int c = p[r].child; c >= 0; ) {
+        int next = p[c].sibling;
+        p[c].sibling = -1;
+        p[c].prev = -1;
+        pq->scratch[count++] = c;
+        c = next;
+    }
+    int pairsCount = 0;
+    for (int i = 0; i + 1 < count; i += 2) {
+        pq->scratch[pairsCount++] = pairMeld(p, pq->scratch[i], pq->scratch[i + 1]);
+    }
+    if (count & 1) pq->scratch[pairsCount++] = pq->scratch[count - 1];
+    int root = -1;
+    for (int i = pairsCount - 1; i >= 0; i--) {
+        root = pairMeld(p, pq->scratch[i], root);
+    }
+    pq->root = root;
+    return ret;
+}
+
+/* ---------- monotone radix heap ---------- */
+
+static int radixBucketOf(unsigned int key, unsigned int last) {
+    return (key == last) ? 0 : 32 - __builtin_clz(key ^ last);
+}
+
+static void radixAppend(RadixBucket* b, unsigned int key, int node) {
+    if (b->size == b->capacity) {
+        b->capacity *= 2;
+        b->items = (PQItem*)realloc(b->items, b->capacity * sizeof(PQItem));
+    }
+    b->items[b->size].key = key;
+    b->items[b->size].node = node;
+    b->size++;
+}
+
+static void radixPush(PriorityQueue* pq, unsigned int key, int node) {
+    radixAppend(&pq->buckets[radixBucketOf(key, pq->last)], key, node);
+    pq->size++;
+}
+
+static PQItem radixPop(PriorityQueue* pq) {
+    RadixBucket* b0 = &pq->buckets[0];
+    if (b0->size == 0) {
+        int i = 1;
+        while (pq->buckets[i].size == 0) i++;
+        RadixBucket* src = &pq->buckets[i];
+        unsigned int minKey = src->items[0].key;
+        for (int j = 1; j < src->size; j++) {
+            if (src->items[j].key < minKey) minKey = src->items[j].key;
+        }
+        // Everything in bucket i lands in a strictly lower bucket.
+        pq->last = minKey;
+        for (int j = 0; j < src->size; j++) {
+            PQItem it = src->items[j];
+            radixAppend(&pq->buckets[radixBucketOf(it.key, minKey)], it.key, it.node);
+        }
+        src->size = 0;
+    }
+    pq->size--;
+    return b0->items[--b0->size];
+}
+
+/* ---------- dispatch ---------- */
+
+void pqPush(PriorityQueue* pq, unsigned int key, int node) {
+    switch (pq->kind) {
+        case PQ_BINARY:
+        case PQ_FOURARY: daryPush(pq, key, node); break;
+        case PQ_PAIRING: pairingPush(pq, key, node); break;
+        case PQ_RADIX:   radixPush(pq, key, node); break;
+    }
+}
+
+void pqDecreaseKey(PriorityQueue* pq, unsigned int key, int node) {
+    // Only the pairing heap can move an entry; the others push a duplicate.
+    pqPush(pq, key, node);
+}
+
+PQItem pqPop(PriorityQueue* pq) {
+    switch (pq->kind) {
+        case PQ_PAIRING: return pairingPop(pq);
+        case PQ_RADIX:   return radixPop(pq);
+        default:         return daryPop(pq);
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <stdbool.h>
+
+/*
+   One priority-queue interface with several backends.
+
+   Every backend orders (key, node) pairs by unsigned key, smallest first.
+   Storage is allocated once in pqCreate and pqReset empties the queue
+   without freeing anything, so one queue can serve many queries.
+
+   - PQ_BINARY / PQ_FOURARY: implicit d-ary heaps. pqDecreaseKey simply
+     pushes a new entry; the caller skips stale entries on pop (the usual
+     "lazy deletion" Dijkstra).
+   - PQ_PAIRING: pairing heap with one slot per node, so a node is in the
+     queue at most once and pqDecreaseKey is a real O(1) decrease-key.
+     Pushing a node that is already queued acts as a decrease-key.
+   - PQ_RADIX: monotone radix heap. Only valid when every pushed key is
+     >= the last popped key (e.g. additive Dijkstra with non-negative
+     weights). Like the d-ary heaps it keeps stale entries.
+*/
+
+typedef enum {
+    PQ_BINARY,
+    PQ_FOURARY,
+    PQ_PAIRING,
+    PQ_RADIX
+} PQKind;
+
+typedef struct {
+    unsigned int key;
+    int node;
+} PQItem;
+
+typedef struct PriorityQueue PriorityQueue;
+
+/* capacity: expected number of live entries (grows if exceeded).
+   nodeCount: node ids are in [0, nodeCount); needed by PQ_PAIRING. */
+PriorityQueue* pqCreate(PQKind kind, int capacity, int nodeCount);
+void pqFree(PriorityQueue* pq);
+void pqReset(PriorityQueue* pq);
+
+void pqPush(PriorityQueue* pq, unsigned int key, int node);
+void pqDecreaseKey(PriorityQueue* pq, unsigned int key, int node);
+PQItem pqPop(PriorityQueue* pq);
+bool pqEmpty(const PriorityQueue* pq);
+int pqSize(const PriorityQueue* pq);
+PQKind pqKind(const PriorityQueue* pq);
+
+#endif
@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "PriorityQueue.h"
+
+/*
+   Microbenchmark for PriorityQueue.c.
+
+   Build:  gcc -O2 PriorityQueueBenchmark.c PriorityQueue.c -o pqbench
+   Run:    ./pqbench [n] [rounds]
+
+   Two mixes per backend:
+   - "push/pop":  push n random keys, then pop them all.
+   - "dijkstra":  pop the minimum, then offer two neighbours with
+                  key = popped + random weight (decrease-key when the node
+                  is already queued with a larger key). Keys are monotone,
+                  so the radix heap is valid for both mixes.
+   The queue is reset, never freed, between rounds.
+*/
+
+static unsigned int rngState = 12345u;
+static unsigned int nextRand(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static const char* kindName(PQKind kind) {
+    switch (kind) {
+        case PQ_BINARY:  return "binary";
+        case PQ_FOURARY: return "4-ary";
+        case PQ_PAIRING: return "pairing";
+        case PQ_RADIX:   return "radix";
+    }
+    return "?";
+}
+
+static bool pushPopMix(PriorityQueue* pq, int n, long long* ops) {
+    pqReset(pq);
+    for (int i = 0; i < n; i++) {
+        pqPush(pq, nextRand() >> 1, i);
+    }
+    unsigned int prev = 0;
+    while (!pqEmpty(pq)) {
+        PQItem it = pqPop(pq);
+        if (it.key < prev) return false;
+        prev = it.key;
+    }
+    *ops += 2LL * n;
+    return true;
+}
+
+static bool dijkstraMix(PriorityQueue* pq, int n, unsigned int* best, bool* done, long long* ops) {
+    pqReset(pq);
+    for (int i = 0; i < n; i++) {
+        best[i] = 0xFFFFFFFFu;
+        done[i] = false;
+    }
+    best[0] = 0;
+    pqPush(pq, 0, 0);
+    unsigned int prev = 0;
+    while (!pqEmpty(pq)) {
+        PQItem it = pqPop(pq);
+        (*ops)++;
+        if (it.key < prev) return false;
+        prev = it.key;
+        if (done[it.node] || it.key != best[it.node]) continue;
+        done[it.node] = true;
+        for (int e = 0; e < 2; e++) {
+            int v = (int)(nextRand() % (unsigned int)n);
+            unsigned int key = it.key + (nextRand() & 1023);
+            if (!done[v] && key < best[v]) {
+                bool queued = (best[v] != 0xFFFFFFFFu);
+                best[v] = key;
+                if (queued) pqDecreaseKey(pq, key, v);
+                else pqPush(pq, key, v);
+                (*ops)++;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int rounds = (argc > 2) ? atoi(argv[2]) : 3;
+    unsigned int* best = (unsigned int*)malloc(n * sizeof(unsigned int));
+    bool* done = (bool*)malloc(n * sizeof(bool));
+    PQKind kinds[] = { PQ_BINARY, PQ_FOURARY, PQ_PAIRING, PQ_RADIX };
+
+    printf("n = %d, rounds = %d\n", n, rounds);
+    printf("%-8s %16s %16s\n", "backend", "push/pop Mops/s", "dijkstra Mops/s");
+    for (int k = 0; k < 4; k++) {
+        PriorityQueue* pq = pqCreate(kinds[k], n, n);
+        long long ops1 = 0, ops2 = 0;
+        bool ok = true;
+
+        rngState = 12345u;
+        double t0 = nowSeconds();
+        for (int r = 0; r < rounds; r++) ok &= pushPopMix(pq, n, &ops1);
+        double t1 = nowSeconds();
+        for (int r = 0; r < rounds; r++) ok &= dijkstraMix(pq, n, best, done, &ops2);
+        double t2 = nowSeconds();
+
+        printf("%-8s %16.1f %16.1f%s\n", kindName(kinds[k]),
+               ops1 / (t1 - t0) / 1e6, ops2 / (t2 - t1) / 1e6,
+               ok ? "" : "  (ORDER VIOLATION)");
+        pqFree(pq);
+    }
+
+    free(best);
+    free(done);
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+
+/*
+   Throughput of DynamicProgrammingVectorized.c against DynamicProgramming.c.
+
+   Build:  gcc -O2 -mavx2 Benchmark.c -o dpbench
+   Run:    ./dpbench [n]
+
+   Runs k in {2, 16, 256, 1000} on the same random input and checks that
+   both versions agree.
+*/
+
+#define maximumLength maximumLengthScalar
+#include "DynamicProgramming.c"
+#undef maximumLength
+
+#define maximumLength maximumLengthVectorized
+#include "DynamicProgrammingVectorized.c"
+#undef maximumLength
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int ks[] = { 2, 16, 256, 1000 };
+
+    srand(3202);
+    int* nums = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) nums[i] = 1 + rand() % 10000000;
+
+    printf("n = %d\n", n);
+    printf("%-6s %14s %14s %10s %8s\n", "k", "scalar Melem/s", "vector Melem/s", "speedup", "answer");
+    for (int i = 0; i < 4; i++) {
+        int k = ks[i];
+        double t0 = nowSeconds();
+        int expected = maximumLengthScalar(nums, n, k);
+        double t1 = nowSeconds();
+        int got = maximumLengthVectorized(nums, n, k);
+        double t2 = nowSeconds();
+        printf("%-6d %14.2f %14.2f %9.2fx %8d%s\n", k, n / (t1 - t0) / 1e6, n / (t2 - t1) / 1e6,
+               (t1 - t0) / (t2 - t1), got, got == expected ? "" : "  (MISMATCH)");
+    }
+
+    free(nums);
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include <stdlib.h>
+#include "ValidSubsequenceKernel.h"
+
+/*
+   Same DP as DynamicProgramming.c with a transposed table, no freq array,
+   no % k in the inner loops and a SIMD max over each row
+   (see ValidSubsequenceKernel.h). Build with -mavx2 or -msse4.1 to get
+   the vector paths.
+*/
+int maximumLength(int* nums, int numsSize, int k) {
+    int *table = calloc((size_t)k * k, sizeof(int));
+    int ans = 1;
+    for (int i = 0; i < numsSize; i++) {
+        int best = validSubseqStep(table, k, nums[i] % k);
+        if (best > ans) ans = best;
+    }
+    free(table);
+    return ans;
+}
@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "StreamingSession.h"
+
+/*
+   StreamingSession against the one-shot maximumLength of
+   DynamicProgrammingVectorized.c.
+
+   Build:  gcc -O2 -mavx2 StreamingBenchmark.c StreamingSession.c -o streambench
+   Run:    ./streambench [n] [checkpoints]
+
+   One random sequence is pushed in chunks of random length into a session
+   holding k in {2, 16, 256, 1000}. At each of `checkpoints` evenly spaced
+   prefix lengths every sessionAnswer is compared with maximumLength over
+   that prefix. The session is then reset and fed again to check that
+   sessionReset forgets the first run.
+*/
+
+#include "DynamicProgrammingVectorized.c"
+
+/* Pushes nums[from..to) in chunks of 1..4096 values; returns seconds spent
+   pushing. */
+static double pushChunks(ValidSubseqSession* s, const int* nums, int from, int to) {
+    double spent = 0;
+    while (from < to) {
+        int chunk = 1 + rand() % 4096;
+        if (chunk > to - from) chunk = to - from;
+        double t0 = nowSeconds();
+        for (int i = from; i < from + chunk; i++) sessionPush(s, nums[i]);
+        spent += nowSeconds() - t0;
+        from += chunk;
+    }
+    return spent;
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 200000;
+    int checkpoints = (argc > 2) ? atoi(argv[2]) : 8;
+    int ks[] = { 2, 16, 256, 1000 };
+    int count = 4;
+
+    srand(3202);
+    int* nums = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) nums[i] = 1 + rand() % 10000000;
+
+    ValidSubseqSession* s = sessionCreate(ks, count);
+    printf("n = %d, %d checkpoints\n", n, checkpoints);
+    printf("%-6s %12s %10s %8s\n", "run", "Mpushes/s", "checked", "bad");
+    for (int run = 0; run < 2; run++) {
+        if (run == 1) sessionReset(s);
+        double pushing = 0;
+        int checked = 0, bad = 0, at = 0;
+        for (int c = 1; c <= checkpoints; c++) {
+            int to = (int)((long long)n * c / checkpoints);
+            pushing += pushChunks(s, nums, at, to);
+            at = to;
+            for (int i = 0; i < count; i++) {
+                int expected = at > 0 ? maximumLength(nums, at, sessionModulus(s, i)) : 0;
+                bad += (sessionAnswer(s, i) != expected);
+                checked++;
+            }
+        }
+        printf("%-6s %12.2f %10d %8d%s\n", run == 0 ? "fresh" : "reset", n / pushing / 1e6,
+               checked, bad, bad ? "  (MISMATCH)" : "");
+    }
+
+    printf("%-6s %12s\n", "k", "bytes");
+    for (int i = 0; i < count; i++) {
+        printf("%-6d %12zu\n", sessionModulus(s, i), sessionMemory(s, i));
+    }
+
+    sessionFree(s);
+    free(nums);
+    return 0;
+}
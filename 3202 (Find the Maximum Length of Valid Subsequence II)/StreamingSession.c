@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ValidSubsequenceKernel.h"
+#include "StreamingSession.h"
+
+// Each table starts on its own cache line inside the arena.
+#define ARENA_ALIGN 64
+
+typedef struct {
+    int k;
+    int best;
+    int* table;         // k * k ints inside the arena
+    size_t bytes;       // table bytes including alignment padding
+} ModulusState;
+
+struct ValidSubseqSession {
+    int count;
+    ModulusState* states;
+    void* arena;
+    size_t arenaBytes;
+};
+
+static size_t alignUp(size_t x) {
+    return (x + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+ValidSubseqSession* sessionCreate(const int* ks, int count) {
+    ValidSubseqSession* s = (ValidSubseqSession*)calloc(1, sizeof(ValidSubseqSession));
+    s->count = count;
+    s->states = (ModulusState*)calloc(count > 0 ? count : 1, sizeof(ModulusState));
+
+    size_t total = 0;
+    for (int i = 0; i < count; i++) {
+        s->states[i].k = ks[i];
+        s->states[i].bytes = alignUp((size_t)ks[i] * ks[i] * sizeof(int));
+        total += s->states[i].bytes;
+    }
+    s->arenaBytes = total;
+    s->arena = aligned_alloc(ARENA_ALIGN, total > 0 ? total : ARENA_ALIGN);
+
+    char* p = (char*)s->arena;
+    for (int i = 0; i < count; i++) {
+        s->states[i].table = (int*)p;
+        p += s->states[i].bytes;
+    }
+    sessionReset(s);
+    return s;
+}
+
+void sessionFree(ValidSubseqSession* s) {
+    if (s == NULL) return;
+    free(s->arena);
+    free(s->states);
+    free(s);
+}
+
+void sessionReset(ValidSubseqSession* s) {
+    memset(s->arena, 0, s->arenaBytes);
+    for (int i = 0; i < s->count; i++) s->states[i].best = 0;
+}
+
+void sessionPush(ValidSubseqSession* s, int value) {
+    for (int i = 0; i < s->count; i++) {
+        ModulusState* st = &s->states[i];
+        int m = value % st->k;
+        if (m < 0) m += st->k;
+        int best = validSubseqStep(st->table, st->k, m);
+        if (best > st->best) st->best = best;
+    }
+}
+
+int sessionAnswer(const ValidSubseqSession* s, int index) {
+    return s->states[index].best;
+}
+
+int sessionModulus(const ValidSubseqSession* s, int index) {
+    return s->states[index].k;
+}
+
+size_t sessionMemory(const ValidSubseqSession* s, int index) {
+    return s->states[index].bytes + sizeof(ModulusState);
+}
+
+int sessionCount(const ValidSubseqSession* s) {
+    return s->count;
+}
@@ -0,0 +1,31 @@
+#ifndef STREAMING_SESSION_H
+#define STREAMING_SESSION_H
+
+#include <stddef.h>
+
+/*
+   Streaming version of maximumLength for several moduli at once.
+
+   A session is created with a set of k values. sessionPush feeds one
+   value and updates the DP table of every k in the same call (the
+   kernel of ValidSubsequenceKernel.h). sessionAnswer returns the current
+   longest valid subsequence for the i-th k in O(1); it is 0 before the
+   first value.
+
+   All tables live in one arena allocated by sessionCreate; pushing never
+   allocates. sessionMemory reports the bytes held for one k.
+*/
+
+typedef struct ValidSubseqSession ValidSubseqSession;
+
+ValidSubseqSession* sessionCreate(const int* ks, int count);
+void sessionFree(ValidSubseqSession* s);
+void sessionReset(ValidSubseqSession* s);
+
+void sessionPush(ValidSubseqSession* s, int value);
+int sessionAnswer(const ValidSubseqSession* s, int index);
+int sessionModulus(const ValidSubseqSession* s, int index);
+size_t sessionMemory(const ValidSubseqSession* s, int index);
+int sessionCount(const ValidSubseqSession* s);
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef VALID_SUBSEQUENCE_KERNEL_H
+#define VALID_SUBSEQUENCE_KERNEL_H
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+/*
+   DP step shared by the vectorized maximumLength and the streaming
+   session.
+
+   The table is stored transposed compared with DynamicProgramming.c:
+   T[c * k + r] = longest valid subsequence whose last element is
+   congruent to c and whose adjacent sums are congruent to r. A residue
+   that has been seen counts as a length-1 subsequence for every r, which
+   replaces the separate freq pass:
+
+       T[m][r] = max(T[m][r], T[(r - m) mod k][r] + 1)
+
+   Row m is contiguous, so the update is a k-wide max. The read side is
+   the wrapped diagonal; (r - m) mod k is replaced by two split loops,
+   r in [m, k) reads index r * (k + 1) - m * k and r in [0, m) reads
+   r * (k + 1) + (k - m) * k. Both loops read before they write, which
+   matters when (r - m) mod k == m.
+*/
+
+/* Updates row[r .. end) from the diagonal entries at r * (k + 1) + base;
+   returns max(best, largest updated entry). */
+static inline int validSubseqSpan(int* table, int k, int* row, int r, int end, int base, int best) {
+#if defined(__AVX2__)
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i vbest = _mm256_set1_epi32(best);
+    __m256i step = _mm256_set1_epi32(8 * (k + 1));
+    __m256i idx = _mm256_add_epi32(
+        _mm256_mullo_epi32(_mm256_setr_epi32(r, r + 1, r + 2, r + 3, r + 4, r + 5, r + 6, r + 7),
+                           _mm256_set1_epi32(k + 1)),
+        _mm256_set1_epi32(base));
+    for (; r + 8 <= end; r += 8) {
+        __m256i prev = _mm256_i32gather_epi32(table, idx, 4);
+        __m256i cur = _mm256_loadu_si256((const __m256i*)(row + r));
+        cur = _mm256_max_epi32(cur, _mm256_add_epi32(prev, one));
+        _mm256_storeu_si256((__m256i*)(row + r), cur);
+        vbest = _mm256_max_epi32(vbest, cur);
+        idx = _mm256_add_epi32(idx, step);
+    }
+    __m128i lo = _mm_max_epi32(_mm256_castsi256_si128(vbest), _mm256_extracti128_si256(vbest, 1));
+    lo = _mm_max_epi32(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2)));
+    lo = _mm_max_epi32(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+    best = _mm_cvtsi128_si32(lo);
+#elif defined(__SSE4_1__)
+    __m128i one = _mm_set1_epi32(1);
+    __m128i vbest = _mm_set1_epi32(best);
+    for (; r + 4 <= end; r += 4) {
+        int at = r * (k + 1) + base;
+        __m128i prev = _mm_setr_epi32(table[at], table[at + k + 1],
+                                      table[at + 2 * (k + 1)], table[at + 3 * (k + 1)]);
+        __m128i cur = _mm_loadu_si128((const __m128i*)(row + r));
+        cur = _mm_max_epi32(cur, _mm_add_epi32(prev, one));
+        _mm_storeu_si128((__m128i*)(row + r), cur);
+        vbest = _mm_max_epi32(vbest, cur);
+    }
+    vbest = _mm_max_epi32(vbest, _mm_shuffle_epi32(vbest, _MM_SHUFFLE(1, 0, 3, 2)));
+    vbest = _mm_max_epi32(vbest, _mm_shuffle_epi32(vbest, _MM_SHUFFLE(2, 3, 0, 1)));
+    best = _mm_cvtsi128_si32(vbest);
+#endif
+    for (; r < end; r++) {
+        int cand = table[r * (k + 1) + base] + 1;
+        if (cand > row[r]) row[r] = cand;
+        if (row[r] > best) best = row[r];
+    }
+    return best;
+}
+
+/* Applies one element with residue m; returns the largest entry of row m. */
+static inline int validSubseqStep(int* table, int k, int m) {
+    int* row = table + m * k;
+    int best = validSubseqSpan(table, k, row, m, k, -m * k, 1);
+    return validSubseqSpan(table, k, row, 0, m, (k - m) * k, best);
+}
+
+#endif
@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "KthCharacter.h"
+#include "main.c"
+
+/*
+   Batch throughput of kthCharacter (main.c), a scalar popcount loop and
+   kthCharacterBatch.
+
+   Build:  gcc -O2 -march=native Benchmark.c KthCharacter.c -o bench
+           (or -mpopcnt, -mavx2, -mavx512f -mavx512vpopcntdq to pick the
+           batch path; it is printed on the first line)
+   Run:    ./bench [count]
+
+   `count` (default 10^7) random k. main.c takes int, so it gets k in
+   [1, 2^30]; the popcount versions get k over all of uint64 and are
+   also run on the small ks to check them against main.c. "masked" is
+   the operations[] variant with a random operations array. Times are
+   the best of ROUNDS runs.
+*/
+
+#define ROUNDS 5
+
+static long checksum(const char* out, int count) {
+    long sum = 0;
+    for (int i = 0; i < count; i++) sum += out[i];
+    return sum;
+}
+
+static void report(const char* name, double best, int count, long sum, int bad) {
+    printf("%-22s %10.2f ms %14.0f k/s  (checksum %ld)%s\n", name, best * 1e3, count / best, sum,
+           bad ? "  (MISMATCH)" : "");
+}
+
+int main(int argc, char** argv) {
+    int count = (argc > 1) ? atoi(argv[1]) : 10000000;
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    printf("batch path: AVX-512 VPOPCNTQ\n");
+#elif defined(__AVX2__)
+    printf("batch path: AVX2 nibble table\n");
+#else
+    printf("batch path: scalar\n");
+#endif
+
+    uint64_t* small = (uint64_t*)malloc(count * sizeof(uint64_t));
+    uint64_t* big = (uint64_t*)malloc(count * sizeof(uint64_t));
+    char* expected = (char*)malloc(count);
+    char* out = (char*)malloc(count);
+    for (int i = 0; i < count; i++) {
+        small[i] = 1 + nextRandom64() % (1u << 30);
+        big[i] = nextRandom64() | 1;
+    }
+    int operations[64];
+    for (int i = 0; i < 64; i++) operations[i] = (int)(nextRandom64() & 1);
+    uint64_t mask = (uint64_t)kthOperationsMask(operations, 64);
+
+    double best = 0, t0, t;
+    for (int r = 0; r < ROUNDS; r++) {
+        t0 = nowSeconds();
+        for (int i = 0; i < count; i++) expected[i] = kthCharacter((int)small[i]);
+        t = nowSeconds() - t0;
+        if (r == 0 || t < best) best = t;
+    }
+    report("main.c (k <= 2^30)", best, count, checksum(expected, count), 0);
+
+    for (int r = 0; r < ROUNDS; r++) {
+        t0 = nowSeconds();
+        kthCharacterBatch(small, count, ~0ULL, out);
+        t = nowSeconds() - t0;
+        if (r == 0 || t < best) best = t;
+    }
+    int bad = 0;
+    for (int i = 0; i < count; i++) bad += (out[i] != expected[i]);
+    report("batch (k <= 2^30)", best, count, checksum(out, count), bad);
+
+    for (int r = 0; r < ROUNDS; r++) {
+        t0 = nowSeconds();
+        for (int i = 0; i < count; i++) expected[i] = kthCharacter64(big[i]);
+        t = nowSeconds() - t0;
+        if (r == 0 || t < best) best = t;
+    }
+    report("scalar popcount", best, count, checksum(expected, count), 0);
+
+    for (int r = 0; r < ROUNDS; r++) {
+        t0 = nowSeconds();
+        kthCharacterBatch(big, count, ~0ULL, out);
+        t = nowSeconds() - t0;
+        if (r == 0 || t < best) best = t;
+    }
+    bad = 0;
+    for (int i = 0; i < count; i++) bad += (out[i] != expected[i]);
+    report("batch", best, count, checksum(out, count), bad);
+
+    for (int r = 0; r < ROUNDS; r++) {
+        t0 = nowSeconds();
+        kthCharacterBatch(big, count, mask, out);
+        t = nowSeconds() - t0;
+        if (r == 0 || t < best) best = t;
+    }
+    bad = 0;
+    for (int i = 0; i < count; i++) bad += (out[i] != kthCharacterMasked64(big[i], mask));
+    report("batch masked", best, count, checksum(out, count), bad);
+
+    free(small);
+    free(big);
+    free(expected);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <string.h>
+#include "KthCharacter.h"
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+unsigned __int128 kthOperationsMask(const int* operations, int operationsSize) {
+    unsigned __int128 mask = 0;
+    int rounds = operationsSize < 128 ? operationsSize : 128;
+    for (int i = 0; i < rounds; i++) {
+        if (operations[i] == 1) mask |= (unsigned __int128)1 << i;
+    }
+    return mask;
+}
+
+void kthCharacterBatch(const uint64_t* k, size_t count, uint64_t mask, char* out) {
+    size_t i = 0;
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i m = _mm512_set1_epi64((long long)mask);
+    const __m512i alphabet = _mm512_set1_epi64(26);
+    const __m512i base = _mm512_set1_epi64('a');
+    for (; i + 8 <= count; i += 8) {
+        __m512i path = _mm512_and_si512(_mm512_sub_epi64(_mm512_loadu_si512(k + i), one), m);
+        __m512i bits = _mm512_popcnt_epi64(path);
+        // bits <= 64, so mod 26 is at most two conditional subtractions.
+        bits = _mm512_mask_sub_epi64(bits, _mm512_cmpge_epu64_mask(bits, alphabet), bits, alphabet);
+        bits = _mm512_mask_sub_epi64(bits, _mm512_cmpge_epu64_mask(bits, alphabet), bits, alphabet);
+        _mm_storel_epi64((__m128i*)(out + i), _mm512_cvtepi64_epi8(_mm512_add_epi64(bits, base)));
+    }
+#elif defined(__AVX2__)
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i m = _mm256_set1_epi64x((long long)mask);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i alphabet = _mm256_set1_epi64x(26);
+    const __m256i below = _mm256_set1_epi64x(25);
+    const __m256i base = _mm256_set1_epi64x('a');
+    // Byte 0 of each 64-bit lane to bytes 0 and 1 of each 128-bit half.
+    const __m256i gather = _mm256_setr_epi8(0, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            0, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    for (; i + 4 <= count; i += 4) {
+        __m256i path = _mm256_and_si256(_mm256_sub_epi64(_mm256_loadu_si256((const __m256i*)(k + i)), one), m);
+        __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(path, nibble));
+        __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(path, 4), nibble));
+        __m256i bits = _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256());
+        bits = _mm256_sub_epi64(bits, _mm256_and_si256(_mm256_cmpgt_epi64(bits, below), alphabet));
+        bits = _mm256_sub_epi64(bits, _mm256_and_si256(_mm256_cmpgt_epi64(bits, below), alphabet));
+        __m256i chars = _mm256_shuffle_epi8(_mm256_add_epi64(bits, base), gather);
+        uint16_t pair[2] = { (uint16_t)_mm256_extract_epi16(chars, 0), (uint16_t)_mm256_extract_epi16(chars, 8) };
+        memcpy(out + i, pair, 4);
+    }
+#endif
+    for (; i < count; i++) out[i] = kthCharacterMasked64(k[i], mask);
+}
+
+char kthCharacterOperations(long long k, int* operations, int operationsSize) {
+    return kthCharacterMasked128((unsigned __int128)k, kthOperationsMask(operations, operationsSize));
+}
@@ -0,0 +1,55 @@
+#ifndef KTH_CHARACTER_H
+#define KTH_CHARACTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+   kthCharacter without the halving loop of main.c.
+
+   Position k - 1 written in binary is the path from the root of the
+   doubling tree: bit i set means "in the appended half of round i + 1",
+   which shifts the letter once. So the k-th character is
+   'a' + popcount(k - 1) mod 26, for any k >= 1 and any width. Build with
+   -mpopcnt (or -march=native) to get the hardware instruction.
+
+   In the operations[] variant (LeetCode 3307), round i + 1 appends a
+   shifted copy only when operations[i] == 1, so only those bits count:
+   'a' + popcount((k - 1) & mask) mod 26 with bit i of mask set iff
+   operations[i] == 1.
+
+   kthCharacterBatch applies the masked rule to an array of k with AVX-512
+   VPOPCNTQ (8 per instruction) when built with -mavx512vpopcntdq
+   -mavx512f, or a nibble-table popcount with AVX2 (4 per iteration),
+   falling back to scalar popcount. Pass mask = ~0 for the plain game.
+*/
+
+static inline char kthCharacter64(uint64_t k) {
+    return (char)('a' + __builtin_popcountll(k - 1) % 26);
+}
+
+static inline char kthCharacterMasked64(uint64_t k, uint64_t mask) {
+    return (char)('a' + __builtin_popcountll((k - 1) & mask) % 26);
+}
+
+static inline char kthCharacterMasked128(unsigned __int128 k, unsigned __int128 mask) {
+    unsigned __int128 path = (k - 1) & mask;
+    int bits = __builtin_popcountll((uint64_t)path) + __builtin_popcountll((uint64_t)(path >> 64));
+    return (char)('a' + bits % 26);
+}
+
+static inline char kthCharacter128(unsigned __int128 k) {
+    return kthCharacterMasked128(k, ~(unsigned __int128)0);
+}
+
+/* Bit i set iff operations[i] == 1, for the first 128 operations (more
+   rounds than that cannot matter for a 128-bit k). */
+unsigned __int128 kthOperationsMask(const int* operations, int operationsSize);
+
+/* out[i] = kthCharacterMasked64(k[i], mask); out is not terminated. */
+void kthCharacterBatch(const uint64_t* k, size_t count, uint64_t mask, char* out);
+
+/* LeetCode 3307 contract. */
+char kthCharacterOperations(long long k, int* operations, int operationsSize);
+
+#endif
@@ -0,0 +1,16 @@
+char kthCharacter(int k) {
+    int l = 1;
+    while (l < k) l *= 2;
+
+    char c = 'a';
+
+    while (l > 1) {
+        l /= 2;
+        if (k > l) {
+            k -= l;
+            c = (c - 'a' + 1) % 26 + 'a';
+        }
+    }
+
+    return c;
+}
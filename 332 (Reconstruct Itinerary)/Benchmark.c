@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "Itinerary.h"
+
+/*
+   findItinerary / itineraryKeys against a direct C port of the Python
+   solution in AlgorithmFoundation.md: tickets sorted with strcmp
+   (destinations descending), each origin's run found by binary search
+   and popped from its tail.
+
+   Build:  gcc -O2 Benchmark.c Itinerary.c -o bench
+   Run:    ./bench [tickets] [airports]
+
+   Tickets (default 4 * 10^6) are the steps of a random walk from JFK over
+   `airports` random codes (default 2000, at most 17576), shuffled, so an
+   itinerary always exists. findItinerary (a malloc per code) and
+   findItineraryPacked (one block) are timed end to end (parsing, walk,
+   output strings); itineraryKeys without parsing or output. All routes
+   are compared with the port's.
+*/
+
+static int byFromThenToDescending(const void* a, const void* b) {
+    char** x = *(char***)a;
+    char** y = *(char***)b;
+    int c = strcmp(x[0], y[0]);
+    return c ? c : strcmp(y[1], x[1]);
+}
+
+/* The Python solution, with the dict replaced by binary search over the
+   sorted tickets. Returns the route; route[i] points into tickets. */
+static char** findItineraryStrings(char*** tickets, int m, int* returnSize) {
+    char*** sorted = (char***)malloc(m * sizeof(char**));
+    memcpy(sorted, tickets, m * sizeof(char**));
+    qsort(sorted, m, sizeof(char**), byFromThenToDescending);
+
+    // tail[g] is the unused end of the run starting at g.
+    int* tail = (int*)malloc(m * sizeof(int));
+    for (int i = 0; i < m; ) {
+        int j = i;
+        while (j < m && strcmp(sorted[j][0], sorted[i][0]) == 0) j++;
+        tail[i] = j;
+        i = j;
+    }
+
+    char** stack = (char**)malloc((m + 1) * sizeof(char*));
+    char** route = (char**)malloc((m + 1) * sizeof(char*));
+    int top = 0, size = 0;
+    stack[top++] = "JFK";
+    while (top > 0) {
+        const char* v = stack[top - 1];
+        int lo = 0, hi = m;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (strcmp(sorted[mid][0], v) < 0) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo < m && strcmp(sorted[lo][0], v) == 0 && tail[lo] > lo) {
+            stack[top++] = sorted[--tail[lo]][1];
+        } else {
+            route[size++] = stack[--top];
+        }
+    }
+    for (int i = 0; i < size / 2; i++) {
+        char* t = route[i];
+        route[i] = route[size - 1 - i];
+        route[size - 1 - i] = t;
+    }
+    free(sorted);
+    free(tail);
+    free(stack);
+    *returnSize = size;
+    return route;
+}
+
+int main(int argc, char** argv) {
+    int m = (argc > 1) ? atoi(argv[1]) : 4000000;
+    int airports = (argc > 2) ? atoi(argv[2]) : 2000;
+    if (airports > 26 * 26 * 26) airports = 26 * 26 * 26;
+    if (airports < 1) airports = 1;
+
+    // Distinct codes, JFK first.
+    int* code = (int*)malloc(AIRPORT_KEYS * sizeof(int));
+    char* taken = (char*)calloc(AIRPORT_KEYS, 1);
+    code[0] = airportKey("JFK");
+    taken[code[0]] = 1;
+    for (int a = 1; a < airports; a++) {
+        int k;
+        do {
+            char c[3] = { (char)('A' + nextRandom() % 26), (char)('A' + nextRandom() % 26),
+                          (char)('A' + nextRandom() % 26) };
+            k = airportKey(c);
+        } while (taken[k]);
+        taken[k] = 1;
+        code[a] = k;
+    }
+
+    char* text = (char*)malloc(8 * (size_t)m + 1);
+    char** rows = (char**)malloc(2 * (size_t)m * sizeof(char*));
+    char*** tickets = (char***)malloc(m * sizeof(char**));
+    uint16_t* from = (uint16_t*)malloc(m * sizeof(uint16_t));
+    uint16_t* to = (uint16_t*)malloc(m * sizeof(uint16_t));
+    uint16_t* route = (uint16_t*)malloc((m + 1) * sizeof(uint16_t));
+    int v = 0;
+    for (int i = 0; i < m; i++) {
+        int w = nextRandom() % airports;
+        rows[2 * i] = text + 8 * (size_t)i;
+        rows[2 * i + 1] = text + 8 * (size_t)i + 4;
+        airportCode(code[v], rows[2 * i]);
+        airportCode(code[w], rows[2 * i + 1]);
+        tickets[i] = rows + 2 * i;
+        v = w;
+    }
+    for (int i = m - 1; i > 0; i--) {
+        int j = nextRandom() % (i + 1);
+        char** t = tickets[i];
+        tickets[i] = tickets[j];
+        tickets[j] = t;
+    }
+
+    printf("tickets = %d, airports = %d\n", m, airports);
+    printf("%-16s %10s %14s\n", "method", "ms", "tickets/s");
+
+    double t0 = nowSeconds();
+    int expectedSize;
+    char** expected = findItineraryStrings(tickets, m, &expectedSize);
+    double t = nowSeconds() - t0;
+    printf("%-16s %10.1f %14.0f\n", "strcmp port", t * 1e3, m / t);
+
+    t0 = nowSeconds();
+    int size;
+    char** result = findItinerary(tickets, m, NULL, &size);
+    t = nowSeconds() - t0;
+    int bad = (size != expectedSize);
+    for (int i = 0; i < size && !bad; i++) bad = strcmp(result[i], expected[i]) != 0;
+    printf("%-16s %10.1f %14.0f%s\n", "findItinerary", t * 1e3, m / t, bad ? "  (MISMATCH)" : "");
+    for (int i = 0; i < size; i++) free(result[i]);
+    free(result);
+
+    t0 = nowSeconds();
+    result = findItineraryPacked(tickets, m, &size);
+    t = nowSeconds() - t0;
+    bad = (size != expectedSize);
+    for (int i = 0; i < size && !bad; i++) bad = strcmp(result[i], expected[i]) != 0;
+    printf("%-16s %10.1f %14.0f%s\n", "packed", t * 1e3, m / t, bad ? "  (MISMATCH)" : "");
+
+    for (int i = 0; i < m; i++) {
+        from[i] = (uint16_t)airportKey(tickets[i][0]);
+        to[i] = (uint16_t)airportKey(tickets[i][1]);
+    }
+    t0 = nowSeconds();
+    size = itineraryKeys(from, to, m, airportKey("JFK"), route);
+    t = nowSeconds() - t0;
+    bad = (size != expectedSize);
+    for (int i = 0; i < size && !bad; i++) bad = (route[i] != airportKey(expected[i]));
+    printf("%-16s %10.1f %14.0f%s\n", "itineraryKeys", t * 1e3, m / t, bad ? "  (MISMATCH)" : "");
+
+    free(result);
+    free(expected);
+    free(code);
+    free(taken);
+    free(text);
+    free(rows);
+    free(tickets);
+    free(from);
+    free(to);
+    free(route);
+    return 0;
+}
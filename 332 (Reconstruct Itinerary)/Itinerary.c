@@ -0,0 +1,131 @@
+#include <stdlib.h>
+#include "Itinerary.h"
+
+int itineraryKeys(const uint16_t* from, const uint16_t* to, int m, int start, uint16_t* route) {
+    // Dense ids in key order; id[key] == -1 for airports not present.
+    int* id = (int*)malloc(AIRPORT_KEYS * sizeof(int));
+    for (int k = 0; k < AIRPORT_KEYS; k++) id[k] = -1;
+    id[start] = 0;
+    for (int i = 0; i < m; i++) {
+        id[from[i]] = 0;
+        id[to[i]] = 0;
+    }
+    uint16_t* keyOf = (uint16_t*)malloc(AIRPORT_KEYS * sizeof(uint16_t));
+    int n = 0;
+    for (int k = 0; k < AIRPORT_KEYS; k++) {
+        if (id[k] < 0) continue;
+        keyOf[n] = (uint16_t)k;
+        id[k] = n++;
+    }
+
+    // An Eulerian path from start needs out - in == 0 everywhere, except
+    // +1 at start when it ends elsewhere (and -1 there).
+    int* balance = (int*)calloc(n, sizeof(int));
+    for (int i = 0; i < m; i++) {
+        balance[id[from[i]]]++;
+        balance[id[to[i]]]--;
+    }
+    int balanced = 1;
+    for (int v = 0; v < n; v++) {
+        if (v == id[start]) balanced &= (balance[v] == 0 || balance[v] == 1);
+        else balanced &= (balance[v] == 0 || balance[v] == -1);
+    }
+    free(balance);
+    if (!balanced) {
+        free(keyOf);
+        free(id);
+        return 0;
+    }
+
+    // Pass 1: tickets by destination id.
+    int* count = (int*)calloc(n + 1, sizeof(int));
+    int* byTo = (int*)malloc((m > 0 ? m : 1) * sizeof(int));
+    for (int i = 0; i < m; i++) count[id[to[i]] + 1]++;
+    for (int v = 0; v < n; v++) count[v + 1] += count[v];
+    for (int i = 0; i < m; i++) byTo[count[id[to[i]]]++] = i;
+
+    // Pass 2: stable by origin, so each origin's range is ascending.
+    int* offset = (int*)calloc(n + 1, sizeof(int));
+    uint16_t* adj = (uint16_t*)malloc((m > 0 ? m : 1) * sizeof(uint16_t));
+    for (int i = 0; i < m; i++) offset[id[from[i]] + 1]++;
+    for (int v = 0; v < n; v++) offset[v + 1] += offset[v];
+    int* cursor = count;
+    for (int v = 0; v < n; v++) cursor[v] = offset[v];
+    for (int j = 0; j < m; j++) {
+        int i = byTo[j];
+        adj[cursor[id[from[i]]]++] = (uint16_t)id[to[i]];
+    }
+    free(byTo);
+
+    // Hierholzer. cursor[v] is the next unused ticket out of v.
+    for (int v = 0; v < n; v++) cursor[v] = offset[v];
+    uint16_t* stack = (uint16_t*)malloc((m + 1) * sizeof(uint16_t));
+    int top = 0, pos = m + 1;
+    stack[top++] = (uint16_t)id[start];
+    while (top > 0) {
+        int v = stack[top - 1];
+        if (cursor[v] < offset[v + 1]) {
+            stack[top++] = adj[cursor[v]++];
+        } else {
+            top--;
+            route[--pos] = keyOf[v];
+        }
+    }
+    // Every pop but the first used a ticket; tickets unreachable from
+    // start leave the route short.
+    int ok = (pos == 0);
+
+    free(stack);
+    free(adj);
+    free(offset);
+    free(count);
+    free(keyOf);
+    free(id);
+    return ok ? m + 1 : 0;
+}
+
+/* Parses the tickets and runs itineraryKeys; the route is in *keys at
+   offset 2 * m, and the caller frees *keys. */
+static int routeOfTickets(char*** tickets, int m, uint16_t** keys) {
+    uint16_t* block = (uint16_t*)malloc((2 * (size_t)m + m + 1) * sizeof(uint16_t));
+    uint16_t* from = block;
+    uint16_t* to = block + m;
+    for (int i = 0; i < m; i++) {
+        from[i] = (uint16_t)airportKey(tickets[i][0]);
+        to[i] = (uint16_t)airportKey(tickets[i][1]);
+    }
+    *keys = block;
+    return itineraryKeys(from, to, m, airportKey("JFK"), block + 2 * m);
+}
+
+char** findItinerary(char*** tickets, int ticketsSize, int* ticketsColSize, int* returnSize) {
+    (void)ticketsColSize;
+    uint16_t* keys;
+    int size = routeOfTickets(tickets, ticketsSize, &keys);
+    const uint16_t* route = keys + 2 * (size_t)ticketsSize;
+
+    char** result = (char**)malloc((size > 0 ? size : 1) * sizeof(char*));
+    for (int i = 0; i < size; i++) {
+        result[i] = (char*)malloc(4);
+        airportCode(route[i], result[i]);
+    }
+    free(keys);
+    *returnSize = size;
+    return result;
+}
+
+char** findItineraryPacked(char*** tickets, int ticketsSize, int* returnSize) {
+    uint16_t* keys;
+    int size = routeOfTickets(tickets, ticketsSize, &keys);
+    const uint16_t* route = keys + 2 * (size_t)ticketsSize;
+
+    char** result = (char**)malloc(size * (sizeof(char*) + 4) + 1);
+    char* codes = (char*)(result + size);
+    for (int i = 0; i < size; i++) {
+        result[i] = codes + 4 * i;
+        airportCode(route[i], result[i]);
+    }
+    free(keys);
+    *returnSize = size;
+    return result;
+}
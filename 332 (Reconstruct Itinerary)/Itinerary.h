@@ -0,0 +1,49 @@
+#ifndef ITINERARY_H
+#define ITINERARY_H
+
+#include <stdint.h>
+
+/*
+   Hierholzer's algorithm from AlgorithmFoundation.md for millions of
+   tickets.
+
+   A three-letter upper-case code packs into a 15-bit key, 5 bits per
+   letter, and keys compare exactly like the codes. The airports present
+   get dense ids in key order, so "smallest destination" is "smallest
+   id" and no string is compared after parsing.
+
+   The tickets are bucketed twice with counting sorts (by destination,
+   then stably by origin) into a CSR layout where every airport's
+   destinations are ascending. The walk keeps a cursor per airport into
+   its own range instead of popping from a sorted list, uses an explicit
+   stack, and writes dead-ended airports from the back of the route, so
+   no reversal is needed.
+*/
+
+#define AIRPORT_KEYS (1 << 15)
+
+static inline int airportKey(const char* code) {
+    return ((code[0] - 'A') << 10) | ((code[1] - 'A') << 5) | (code[2] - 'A');
+}
+
+static inline void airportCode(int key, char* out) {
+    out[0] = (char)('A' + (key >> 10));
+    out[1] = (char)('A' + ((key >> 5) & 31));
+    out[2] = (char)('A' + (key & 31));
+    out[3] = '\0';
+}
+
+/* Tickets from[i] -> to[i] are airport keys. Writes the lexicographically
+   smallest itinerary from start that uses every ticket once into
+   route[0 .. m] (keys) and returns m + 1; returns 0 if there is none. */
+int itineraryKeys(const uint16_t* from, const uint16_t* to, int m, int start, uint16_t* route);
+
+/* LeetCode 332. Each code is its own allocation, as LeetCode frees
+   them: every result[i], then result. */
+char** findItinerary(char*** tickets, int ticketsSize, int* ticketsColSize, int* returnSize);
+
+/* The same route as one allocation, the row pointers followed by the
+   codes, released with a single free. */
+char** findItineraryPacked(char*** tickets, int ticketsSize, int* returnSize);
+
+#endif
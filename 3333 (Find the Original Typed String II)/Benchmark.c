@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "TypedOriginals.h"
+
+#define main mainExample
+#include "main.c"
+#undef main
+
+/*
+   possibleStringCountFast against possibleStringCount from main.c.
+
+   Build:  gcc -O2 -mavx2 Benchmark.c TypedOriginals.c -o bench
+           (drop -mavx2 for the SSE2 run scan)
+   Run:    ./bench
+
+   Words of 5 * 10^5 characters with k = 2000, the LeetCode maximum:
+   - "long runs":   1000 runs of 500, so m < k and the DP runs with
+                    L = 1000 over 1000 kept runs (the worst case for k)
+   - "near k":      1999 runs, almost all of length 1, L = 1
+   - "short runs":  random letters from {a, b, c}; m >= k, no DP
+   and, beyond the LeetCode bounds, a 5 * 10^6 character word of 10^4
+   runs with k = 2 * 10^4, and 43 runs of 2 followed by one run of
+   2^21 + 1 (a run length that overflowed the 64-bit lazy product) at
+   k = 1 and k = 60. Times are the best of ROUNDS calls.
+*/
+
+#define ROUNDS 5
+
+/* runs runs of equal length, letters alternating so neighbours differ. */
+static void fillRuns(char* w, int n, int runs) {
+    for (int r = 0; r < runs; r++) {
+        int lo = (int)((long long)n * r / runs), hi = (int)((long long)n * (r + 1) / runs);
+        memset(w + lo, 'a' + r % 2, hi - lo);
+    }
+    w[n] = '\0';
+}
+
+static void runCase(const char* name, char* w, int n, int k) {
+    double bestOld = 0, bestNew = 0;
+    int expected = 0, got = 0;
+    for (int r = 0; r < ROUNDS; r++) {
+        double t0 = nowSeconds();
+        expected = possibleStringCount(w, k);
+        double t = nowSeconds() - t0;
+        if (r == 0 || t < bestOld) bestOld = t;
+
+        t0 = nowSeconds();
+        got = possibleStringCountFast(w, (size_t)n, k);
+        t = nowSeconds() - t0;
+        if (r == 0 || t < bestNew) bestNew = t;
+    }
+    printf("%-12s %9d %6d %12.3f %12.3f %9.1fx%s\n", name, n, k, bestOld * 1e3, bestNew * 1e3,
+           bestOld / bestNew, expected == got ? "" : "  (MISMATCH)");
+}
+
+int main(void) {
+    int n = 500000, big = 5000000;
+    char* w = (char*)malloc(big + 1);
+    printf("%-12s %9s %6s %12s %12s %10s\n", "word", "n", "k", "main.c ms", "fast ms", "speedup");
+
+    fillRuns(w, n, 1000);
+    runCase("long runs", w, n, 2000);
+
+    // 1998 single letters, then one run holding the rest.
+    for (int i = 0; i < 1998; i++) w[i] = 'a' + i % 2;
+    memset(w + 1998, 'c', n - 1998);
+    w[n] = '\0';
+    runCase("near k", w, n, 2000);
+
+    for (int i = 0; i < n; i++) w[i] = 'a' + nextRandom() % 3;
+    w[n] = '\0';
+    runCase("short runs", w, n, 2000);
+
+    fillRuns(w, big, 10000);
+    runCase("5M chars", w, big, 20000);
+
+    int longRun = (1 << 21) + 1, longN = 86 + longRun;
+    for (int i = 0; i < 86; i++) w[i] = 'a' + i / 2 % 2;
+    memset(w + 86, 'c', longRun);
+    w[longN] = '\0';
+    runCase("long run", w, longN, 1);
+    runCase("long run", w, longN, 60);
+
+    free(w);
+    return 0;
+}
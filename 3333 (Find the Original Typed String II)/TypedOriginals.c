@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "TypedOriginals.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define RUN_WIDTH 32
+#define runEqualMask(p) ((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8( \
+    _mm256_loadu_si256((const __m256i*)(p)), _mm256_loadu_si256((const __m256i*)((p) + 1)))))
+#define RUN_FULL 0xFFFFFFFFu
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RUN_WIDTH 16
+#define runEqualMask(p) ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8( \
+    _mm_loadu_si128((const __m128i*)(p)), _mm_loadu_si128((const __m128i*)((p) + 1)))))
+#define RUN_FULL 0xFFFFu
+#endif
+
+#define TYPED_MOD 1000000007u
+
+typedef struct {
+    long long runs;         // m, all runs so far
+    uint64_t product;       // product of run lengths, < 2^44 between runs
+    int* kept;              // lengths >= 2 seen while runs < k
+    int keptCount;
+    int k;
+} RunStats;
+
+static inline void addRun(RunStats* st, size_t length) {
+    st->runs++;
+    if (length < 2) return;
+    // The DP caps every run at L - 1 < k extra letters, so k fits any run.
+    if (st->runs < st->k) st->kept[st->keptCount++] = length < (size_t)st->k ? (int)length : st->k;
+    // product < 2^44 and length < 2^20 keep the multiply inside 64 bits;
+    // longer runs reduce both factors below 2^30 first.
+    uint64_t factor = length;
+    if (factor >= (1u << 20)) {
+        factor %= TYPED_MOD;
+        st->product %= TYPED_MOD;
+    }
+    st->product *= factor;
+    if (st->product >= (1ULL << 44)) st->product %= TYPED_MOD;
+}
+
+int possibleStringCountFast(const char* word, size_t n, int k) {
+    if ((size_t)k > n) return 0;
+
+    RunStats st = { 0, 1, NULL, 0, k };
+    st.kept = (int*)malloc((size_t)k * sizeof(int));
+
+    // Run ends: positions i with word[i] != word[i + 1].
+    size_t i = 0, runStart = 0;
+#ifdef RUN_WIDTH
+    for (; i + RUN_WIDTH < n; i += RUN_WIDTH) {
+        uint32_t ends = ~runEqualMask(word + i) & RUN_FULL;
+        while (ends) {
+            size_t end = i + __builtin_ctz(ends);
+            addRun(&st, end + 1 - runStart);
+            runStart = end + 1;
+            ends &= ends - 1;
+        }
+    }
+#endif
+    for (; i + 1 < n; i++) {
+        if (word[i] != word[i + 1]) {
+            addRun(&st, i + 1 - runStart);
+            runStart = i + 1;
+        }
+    }
+    addRun(&st, n - runStart);
+    uint32_t product = (uint32_t)(st.product % TYPED_MOD);
+
+    if (st.runs >= k) {
+        free(st.kept);
+        return (int)product;
+    }
+
+    // dp[s] = ways to pick u_i summing to s < L over the runs so far.
+    int L = k - (int)st.runs;
+    uint32_t* dp = (uint32_t*)calloc(L, sizeof(uint32_t));
+    dp[0] = 1;
+    int reach = 0;      // dp[s] == 0 for s > reach
+    for (int r = 0; r < st.keptCount; r++) {
+        int D = st.kept[r] - 1;
+        if (D > L - 1) D = L - 1;
+        reach = (reach + D < L - 1) ? reach + D : L - 1;
+
+        uint32_t window = 0;
+        for (int s = reach - D; s <= reach; s++) {
+            window += dp[s];
+            if (window >= TYPED_MOD) window -= TYPED_MOD;
+        }
+        for (int s = reach; s >= 0; s--) {
+            uint32_t old = dp[s];
+            dp[s] = window;
+            window = (window >= old) ? window - old : window + TYPED_MOD - old;
+            if (s - D - 1 >= 0) {
+                window += dp[s - D - 1];
+                if (window >= TYPED_MOD) window -= TYPED_MOD;
+            }
+        }
+    }
+
+    uint32_t bad = 0;
+    for (int s = 0; s < L; s++) {
+        bad += dp[s];
+        if (bad >= TYPED_MOD) bad -= TYPED_MOD;
+    }
+    free(dp);
+    free(st.kept);
+    return (int)((product + TYPED_MOD - bad) % TYPED_MOD);
+}
@@ -0,0 +1,32 @@
+#ifndef TYPED_ORIGINALS_H
+#define TYPED_ORIGINALS_H
+
+#include <stddef.h>
+
+/*
+   possibleStringCount from main.c for multi-million-character words.
+
+   One pass over word finds the runs: adjacent bytes are compared a
+   vector at a time (32 with AVX2, 16 with SSE2), and each zero bit of
+   the equality mask ends a run. The product of the run lengths is
+   reduced mod 1e9+7 only when it passes 2^44, not after every run;
+   runs of 2^20 or more characters are reduced before the multiply.
+
+   Only runs of length >= 2 matter to the DP (u_i has one choice for the
+   others), and only while fewer than k runs have been seen: once
+   m >= k every original is long enough and the answer is the product,
+   so the DP is skipped. The kept runs therefore fit in k ints.
+
+   Each kept run is a bounded-knapsack step over dp[0 .. L), L = k - m,
+   done in place right to left with a sliding window sum:
+   new[s] = old[s - D] + ... + old[s], D = min(C_i - 1, L - 1). The
+   window only needs old values below s, which are not yet overwritten,
+   so one uint32 buffer of L entries is all the DP memory, and indices
+   above the largest reachable sum are never touched.
+*/
+
+/* Originals of length >= k that could have produced word[0 .. n),
+   mod 1e9+7. */
+int possibleStringCountFast(const char* word, size_t n, int k);
+
+#endif
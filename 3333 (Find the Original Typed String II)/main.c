@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MOD 1000000007
+
+long long modexp(long long a, long long e) {
+    long long r = 1;
+    a %= MOD;
+    while (e) {
+        if (e & 1) r = (r * a) % MOD;
+        a = (a * a) % MOD;
+        e >>= 1;
+    }
+    return r;
+}
+
+int possibleStringCount(char* word, int k) {
+    int n = strlen(word);
+    int *C = malloc((n+1) * sizeof(int));
+    int m = 0;
+    for (int i = 0; i < n; ) {
+        int j = i+1;
+        while (j < n && word[j] == word[i]) j++;
+        C[m++] = j - i;
+        i = j;
+    }
+    if (k > n) {
+        free(C);
+        return 0;
+    }
+    long long prodC = 1;
+    for (int i = 0; i < m; i++) {
+        prodC = (prodC * C[i]) % MOD;
+    }
+    if (m >= k) {
+        free(C);
+        return (int)prodC;
+    }
+    int L = k - m;
+    long long *dp = calloc(L, sizeof(long long));
+    dp[0] = 1;
+    long long *pref = malloc(L * sizeof(long long));
+    for (int i = 0; i < m; i++) {
+        int D = C[i] - 1;
+        pref[0] = dp[0];
+        for (int s = 1; s < L; s++) {
+            pref[s] = (pref[s-1] + dp[s]) % MOD;
+        }
+        for (int s = 0; s < L; s++) {
+            if (s <= D) {
+                dp[s] = pref[s];
+            } else {
+                dp[s] = (pref[s] - pref[s - D - 1] + MOD) % MOD;
+            }
+        }
+    }
+    long long bad = 0;
+    for (int s = 0; s < L; s++) {
+        bad = (bad + dp[s]) % MOD;
+    }
+    long long ans = (prodC - bad + MOD) % MOD;
+    free(C);
+    free(dp);
+    free(pref);
+    return (int)ans;
+}
+
+int main() {
+    char w1[] = "aabbccdd";
+    printf("%d\n", possibleStringCount(w1, 7));
+    printf("%d\n", possibleStringCount(w1, 8));
+
+    char w2[] = "aaabbb";
+    printf("%d\n", possibleStringCount(w2, 3));
+    return 0;
+}
@@ -1,12 +1,13 @@
 #include <stdlib.h>
 #include <string.h>
+#include "../GRAPHS/CSRGraph.h"
 
 typedef struct {
     int node;
     int parity;
 } QueueNode;
 
-void bfs_parity(int** edges, int edgesSize, int* edgesColSize, int n, int start, int* parities) {
+void bfs_parity(const CSRGraph* graph, int n, int start, int* parities) {
     int* visited = (int*)malloc(n * sizeof(int));
     memset(visited, 0, n * sizeof(int));
     QueueNode* queue = (QueueNode*)malloc(n * sizeof(QueueNode));
@@ -19,15 +20,11 @@ void bfs_parity(int** edges, int edgesSize, int* edgesColSize, int n, int start,
         QueueNode current = queue[front++];
         parities[current.node] = current.parity;
 
-        for (int i = 0; i < edgesSize; i++) {
-            int u = edges[i][0];
-            int v = edges[i][1];
-            if (u == current.node && !visited[v]) {
+        for (int i = graph->offset[current.node]; i < graph->offset[current.node + 1]; i++) {
+            int v = graph->adj[i];
+            if (!visited[v]) {
                 visited[v] = 1;
                 queue[rear++] = (QueueNode){v, current.parity ^ 1};
-            } else if (v == current.node && !visited[u]) {
-                visited[u] = 1;
-                queue[rear++] = (QueueNode){u, current.parity ^ 1};
             }
         }
     }
@@ -42,10 +39,13 @@ int* maxTargetNodes(int** edges1, int edges1Size, int* edges1ColSize, int** edge
     *returnSize = n;
     int* answer = (int*)malloc(n * sizeof(int));
 
+    CSRGraph* graph1 = csrBuild(n, edges1, edges1Size, CSR_UNDIRECTED);
+    CSRGraph* graph2 = csrBuild(m, edges2, edges2Size, CSR_UNDIRECTED);
+
     int* tree1_evens = (int*)malloc(n * sizeof(int));
     for (int i = 0; i < n; i++) {
         int* parities = (int*)malloc(n * sizeof(int));
-        bfs_parity(edges1, edges1Size, edges1ColSize, n, i, parities);
+        bfs_parity(graph1, n, i, parities);
         int count = 0;
         for (int j = 0; j < n; j++) {
             if (parities[j] == 0) {
@@ -59,7 +59,7 @@ int* maxTargetNodes(int** edges1, int edges1Size, int* edges1ColSize, int** edge
     int* tree2_odds = (int*)malloc(m * sizeof(int));
     for (int j = 0; j < m; j++) {
         int* parities = (int*)malloc(m * sizeof(int));
-        bfs_parity(edges2, edges2Size, edges2ColSize, m, j, parities);
+        bfs_parity(graph2, m, j, parities);
         int count = 0;
         for (int k = 0; k < m; k++) {
             if (parities[k] == 1) {
@@ -83,6 +83,8 @@ int* maxTargetNodes(int** edges1, int edges1Size, int* edges1ColSize, int** edge
 
     free(tree1_evens);
     free(tree2_odds);
+    csrFree(graph1);
+    csrFree(graph2);
 
     return answer;
 }
\ No newline at end of file
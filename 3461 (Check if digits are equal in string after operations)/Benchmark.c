@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+
+#include "main.c"
+
+#define hasSameDigits hasSameDigitsQuadratic
+#include "main (quadratic).c"
+#undef hasSameDigits
+
+/*
+   hasSameDigits (binomials mod 2 and mod 5) against the SSE2 fold and
+   the original quadratic folding, on random digit strings of 10^3 .. 10^8
+   digits.
+
+   Build:  gcc -O2 Benchmark.c -o bench
+   Run:    ./bench [maxDigits] [maxQuadraticDigits]
+
+   The folds only run up to maxQuadraticDigits (default 10^5); the
+   original works in place with a VLA on the stack, so it gets a copy.
+   The last large row, 5^11 + 1 digits, is the worst case for the mod-5
+   walk: every base-5 digit of n is 4, so all n + 1 binomials are nonzero.
+   The second table is for short strings.
+*/
+
+/* Random digits; with makeEqual the last digit is chosen so the string
+   folds to two equal digits when some choice does. */
+static void randomDigits(char* s, size_t length, int makeEqual) {
+    for (size_t i = 0; i < length; i++) s[i] = '0' + rand() % 10;
+    s[length] = '\0';
+    for (int d = 0; makeEqual && d < 10 && !hasSameDigits(s); d++) s[length - 1] = '0' + d;
+}
+
+int main(int argc, char** argv) {
+    size_t maxDigits = (argc > 1) ? strtoull(argv[1], NULL, 10) : 100000000;
+    size_t maxQuadratic = (argc > 2) ? strtoull(argv[2], NULL, 10) : 100000;
+    char* s = (char*)malloc(maxDigits + 1);
+    char* copy = (char*)malloc(maxQuadratic + 1);
+    int bad = 0;
+    srand(3461);
+
+    size_t lengths[16];
+    int count = 0;
+    for (size_t length = 1000; length <= maxDigits; length *= 10) lengths[count++] = length;
+    if (48828126 <= maxDigits) lengths[count++] = 48828126;
+
+    printf("%10s %12s %12s %14s %10s\n", "digits", "binomial ms", "fold ms", "quadratic ms", "MB/s");
+    for (int k = 0; k < count; k++) {
+        size_t length = lengths[k];
+        randomDigits(s, length, k % 2);
+        double t0 = nowSeconds();
+        bool answer = hasSameDigits(s);
+        double t = nowSeconds() - t0;
+
+        char fold[32] = "-", quadratic[32] = "-";
+        if (length <= maxQuadratic) {
+            t0 = nowSeconds();
+            bad += hasSameDigitsFold(s) != answer;
+            snprintf(fold, sizeof(fold), "%.2f", (nowSeconds() - t0) * 1e3);
+            memcpy(copy, s, length + 1);
+            t0 = nowSeconds();
+            bad += hasSameDigitsQuadratic(copy) != answer;
+            snprintf(quadratic, sizeof(quadratic), "%.2f", (nowSeconds() - t0) * 1e3);
+        }
+        printf("%10zu %12.3f %12s %14s %10.1f\n", length, t * 1e3, fold, quadratic,
+               length / t * 1e-6);
+    }
+
+    printf("\n%10s %12s %12s\n", "digits", "binomial ns", "fold ns");
+    enum { REPS = 20000 };
+    for (int length = 8; length <= 1024; length *= 2) {
+        randomDigits(s, length, 0);
+        // Read the pointer back each time so the calls are not hoisted.
+        char* volatile input = s;
+        int same = 0;
+        double t0 = nowSeconds();
+        for (int r = 0; r < REPS; r++) same += hasSameDigits(input);
+        double tBinomial = nowSeconds() - t0;
+        t0 = nowSeconds();
+        for (int r = 0; r < REPS; r++) same -= hasSameDigitsFold(input);
+        double tFold = nowSeconds() - t0;
+        bad += same != 0;
+        printf("%10d %12.1f %12.1f\n", length, tBinomial * 1e9 / REPS, tFold * 1e9 / REPS);
+    }
+    if (bad) printf("MISMATCH\n");
+
+    free(s);
+    free(copy);
+    return 0;
+}
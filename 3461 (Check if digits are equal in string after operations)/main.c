@@ -1,18 +1,109 @@
+#include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+   After length - 2 folds the two remaining digits are
+
+       d0 = sum C(n, i) * s[i]      mod 10,   n = length - 2
+       d1 = sum C(n, i) * s[i + 1]  mod 10
+
+   so the answer is whether sum C(n, i) * (s[i] - s[i + 1]) is 0 mod 10,
+   i.e. 0 mod 2 and 0 mod 5 (the CRT split of mod 10).
+
+   By Lucas's theorem only a few binomials are nonzero, and both sums
+   walk just those:
+   mod 2: C(n, i) is odd iff (i & n) == i, so i runs over the submasks
+          of n, 2^popcount(n) terms.
+   mod 5: C(n, i) = prod C(n_j, i_j) mod 5 over the base-5 digits, which
+          is nonzero iff every i_j <= n_j; prod (n_j + 1) terms.
+   Both counts are at most n + 1 and usually far smaller, so this is
+   O(length) time at worst, O(1) memory, and s is not modified.
+*/
+
+/* advance5[d][k] = C(d, k + 1) / C(d, k) mod 5, for k < d < 5. */
+static const unsigned char advance5[5][4] = {
+    { 0, 0, 0, 0 },
+    { 1, 0, 0, 0 },
+    { 2, 3, 0, 0 },
+    { 3, 1, 2, 0 },
+    { 4, 4, 4, 4 }
+};
+
+static bool binomialSameDigits(const char* s, size_t length) {
+    size_t n = length - 2;
+
+    // mod 2: i runs over the submasks of n in increasing order.
+    int sum2 = 0;
+    for (size_t i = 0; ; i = ((i | ~n) + 1) & n) {
+        sum2 ^= (s[i] ^ s[i + 1]) & 1;
+        if (i == n) break;
+    }
+
+    // mod 5: i runs over the numbers whose base-5 digits are all <= those
+    // of n, like an odometer with wheel j going 0..nDigit[j]. Resetting a
+    // wheel multiplies by C(d, d)^-1 * C(d, 0) = 1, so only the wheel that
+    // advances changes the product.
+    unsigned char nDigit[32], iDigit[32] = { 0 };
+    size_t power[32];
+    int digits = 0;
+    for (size_t x = n, p = 1; x > 0; x /= 5, p *= 5) {
+        nDigit[digits] = x % 5;
+        power[digits] = p;
+        digits++;
+    }
+    long long sum5 = 0;
+    int product = 1;
+    for (size_t i = 0; ; ) {
+        sum5 += product * (s[i] - s[i + 1]);
+        int j = 0;
+        while (j < digits && iDigit[j] == nDigit[j]) {
+            i -= iDigit[j] * power[j];
+            iDigit[j++] = 0;
+        }
+        if (j == digits) break;
+        product = product * advance5[nDigit[j]][iDigit[j]] % 5;
+        iDigit[j]++;
+        i += power[j];
+    }
+    return sum2 == 0 && sum5 % 5 == 0;
+}
 
 bool hasSameDigits(char* s) {
-    int length = strlen(s);
-    char temp[length];
+    return binomialSameDigits(s, strlen(s));
+}
+
+/*
+   The quadratic folding, kept for comparison: heap buffer instead of a
+   VLA, digit values instead of characters, and 16 digits per step with
+   SSE2. It loses to the binomial sums even on 8-digit strings.
+*/
+bool hasSameDigitsFold(const char* s) {
+    size_t length = strlen(s);
+    unsigned char* d = (unsigned char*)malloc(length);
+    for (size_t i = 0; i < length; i++) d[i] = s[i] - '0';
 
-    while (length != 2) {
-        for (int i = 0; i < length - 1; i++) {
-            temp[i] = ((s[i] - '0' + s[i+1] - '0') % 10 + '0');
+    for (size_t len = length; len > 2; len--) {
+        size_t i = 0;
+#ifdef __SSE2__
+        // a + b is at most 18; if it is below 10, sum - 10 wraps above it.
+        const __m128i ten = _mm_set1_epi8(10);
+        for (; i + 16 < len; i += 16) {
+            __m128i sum = _mm_add_epi8(_mm_loadu_si128((const __m128i*)(d + i)),
+                                       _mm_loadu_si128((const __m128i*)(d + i + 1)));
+            _mm_storeu_si128((__m128i*)(d + i), _mm_min_epu8(sum, _mm_sub_epi8(sum, ten)));
         }
-        for (int i = 0; i < length - 1; i++) {
-            s[i] = temp[i];
+#endif
+        for (; i + 1 < len; i++) {
+            int v = d[i] + d[i + 1];
+            d[i] = v >= 10 ? v - 10 : v;
         }
-        length--;
     }
-
-    return s[0] == s[1];
-}
\ No newline at end of file
+    bool same = d[0] == d[1];
+    free(d);
+    return same;
+}
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../BENCH/BenchUtil.h"
+#include "ConwayEngine.h"
+
+#include "Count and Say.c"
+
+#define reverse reverseFixed
+#define intToString intToStringFixed
+#define countAndSay countAndSayFixed
+#include "Count and Say (fixed buffer).c"
+#undef reverse
+#undef intToString
+#undef countAndSay
+
+/*
+   countAndSay (ping-pong buffers) and countAndSayToFd against the original
+   fixed 5000-byte version, for n = 1..70.
+
+   Build:  gcc -O2 Benchmark.c ConwayEngine.c -o bench
+   Run:    ./bench [maxN] [printEvery]
+
+   The fixed-buffer version only runs while its term fits (n <= 30).
+   Every length is checked against ConwayEngine and every fixed-buffer
+   term against the new one. Term 70 is about 180 MB and needs roughly
+   twice that while it is built.
+*/
+
+#define FIXED_CAPACITY 5000
+
+int main(int argc, char** argv) {
+    int maxN = (argc > 1) ? atoi(argv[1]) : 70;
+    int printEvery = (argc > 2) ? atoi(argv[2]) : 5;
+    ConwayEngine* e = casCreate(maxN);
+    int devNull = open("/dev/null", O_WRONLY);
+
+    printf("%4s %12s %12s %12s %12s %10s\n", "n", "length", "fixed us", "buffers us", "to fd us", "MB/s");
+    double totalNew = 0, totalFd = 0;
+    int bad = 0;
+    for (int n = 1; n <= maxN; n++) {
+        char expected[64];
+        casLength(e, n, expected, sizeof(expected));
+        size_t len = (size_t)strtoull(expected, NULL, 10);
+
+        // Repeat short terms so every timing covers at least ~10 ms.
+        int reps = 0;
+        char* term = NULL;
+        double t0 = nowSeconds(), tNew;
+        do {
+            free(term);
+            term = countAndSay(n);
+            reps++;
+        } while ((tNew = nowSeconds() - t0) < 0.01);
+        tNew /= reps;
+        bad += strlen(term) != len;
+
+        double tFixed = -1;
+        if (len < FIXED_CAPACITY) {
+            reps = 0;
+            char* old = NULL;
+            t0 = nowSeconds();
+            do {
+                free(old);
+                old = countAndSayFixed(n);
+                reps++;
+            } while ((tFixed = nowSeconds() - t0) < 0.01);
+            tFixed /= reps;
+            bad += strcmp(old, term) != 0;
+            free(old);
+        }
+        free(term);
+
+        reps = 0;
+        double tFd;
+        t0 = nowSeconds();
+        do {
+            bad += countAndSayToFd(n, devNull) != 0;
+            reps++;
+        } while ((tFd = nowSeconds() - t0) < 0.01);
+        tFd /= reps;
+
+        totalNew += tNew;
+        totalFd += tFd;
+        if (n % printEvery == 0 || n == maxN) {
+            char fixed[16] = "-";
+            if (tFixed >= 0) snprintf(fixed, sizeof(fixed), "%.2f", tFixed * 1e6);
+            printf("%4d %12zu %12s %12.2f %12.2f %10.1f\n", n, len, fixed,
+                   tNew * 1e6, tFd * 1e6, len / tNew * 1e-6);
+        }
+    }
+    printf("sum over n = 1..%d: buffers %.3f s, to fd %.3f s%s\n", maxN, totalNew, totalFd,
+           bad ? "  (MISMATCH)" : "");
+
+    close(devNull);
+    casFree(e);
+    return 0;
+}
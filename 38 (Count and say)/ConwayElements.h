@@ -0,0 +1,148 @@
+#ifndef CONWAY_ELEMENTS_H
+#define CONWAY_ELEMENTS_H
+
+/* Generated by GenerateElements.py; do not edit. */
+
+#define CAS_ATOMS 99
+#define CAS_ELEMENTS 92
+#define CAS_MAX_DECAY 6
+
+/* Atom 0 is term 1 of the sequence. */
+static const char* const casAtom[CAS_ATOMS] = {
+    "1",  // transient
+    "11",  // transient
+    "21",  // transient
+    "1211",  // transient
+    "111221",  // transient
+    "312211",  // transient
+    "13112221",  // transient
+    "11132",
+    "13211",
+    "311312",
+    "11131221",
+    "1321131112",
+    "3113112211",
+    "11131221133112",
+    "132113212221",
+    "311311222",
+    "12",
+    "32112",
+    "111312211312113211",
+    "1321132",
+    "132",
+    "1112",
+    "13122112",
+    "311311222113111221131221",
+    "111312211312",
+    "111312",
+    "3112",
+    "111311222112",
+    "132211331222113112211",
+    "3113112221131112",
+    "31131112",
+    "132112",
+    "31132",
+    "1322112",
+    "1113222",
+    "311322113212221",
+    "13221133112",
+    "1321133112",
+    "1113122112",
+    "13211312",
+    "1113222112",
+    "311332",
+    "13211322211312113211",
+    "11131",
+    "22",
+    "311311222112",
+    "11131221131112",
+    "3113322112",
+    "312",
+    "1113122113322113111221131221",
+    "311311",
+    "3113112221133112",
+    "123222112",
+    "131112",
+    "12322211331222113112211",
+    "13211321",
+    "13",
+    "111213322112",
+    "11133112",
+    "1112133",
+    "11131221131211",
+    "1113",
+    "31121123222112",
+    "3112112",
+    "3",
+    "311311222113111221",
+    "3113",
+    "132112211213322112",
+    "1321122112",
+    "1322113312211",
+    "132113",
+    "111312212221121123222112",
+    "11131221222112",
+    "3112221",
+    "1113122113",
+    "3113112211322112211213322112",
+    "3113112211322112",
+    "311311222113",
+    "1321132122211322212221121123222112",
+    "13211321222113222112",
+    "1322113",
+    "111312211312113221133211322112211213322112",
+    "11131221131211322113322112",
+    "1113222113",
+    "31131122211311122113222",
+    "312211322212221121123222112",
+    "3113322113",
+    "13221133122211332",
+    "13112221133211322112211213322112",
+    "123222113",
+    "111213322113",
+    "31121123222113",
+    "132112211213322113",
+    "111312212221121123222113",
+    "3113112211322112211213322113",
+    "1321132122211322212221121123222113",
+    "111312211312113221133211322112211213322113",
+    "312211322212221121123222113",
+    "13112221133211322112211213322113",
+};
+
+static const unsigned char casAtomLength[CAS_ATOMS] = {
+    1, 2, 2, 4, 6, 6, 8, 5, 5, 6, 8, 10, 10, 14, 12, 9,
+    2, 5, 18, 7, 3, 4, 8, 24, 12, 6, 4, 12, 21, 16, 8, 6,
+    5, 7, 7, 15, 11, 10, 10, 8, 10, 6, 20, 5, 2, 12, 14, 10,
+    3, 28, 6, 16, 9, 6, 23, 8, 2, 12, 8, 7, 14, 4, 14, 7,
+    1, 18, 4, 18, 10, 13, 6, 24, 14, 7, 10, 28, 16, 12, 34, 20,
+    7, 42, 26, 10, 23, 27, 10, 17, 32, 9, 12, 14, 18, 24, 28, 34,
+    42, 27, 32,
+};
+
+/* say(casAtom[a]) is the concatenation of casAtom[casDecay[j]] for
+   casDecayStart[a] <= j < casDecayStart[a + 1]. */
+static const unsigned short casDecayStart[CAS_ATOMS + 1] = {
+    0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 17, 18,
+    20, 21, 22, 23, 24, 25, 26, 27, 29, 30, 31, 32, 34, 37, 39, 40,
+    41, 42, 43, 44, 45, 48, 52, 53, 54, 55, 58, 59, 60, 61, 63, 64,
+    66, 67, 69, 70, 75, 76, 77, 81, 82, 83, 84, 86, 88, 89, 90, 91,
+    92, 93, 95, 96, 97, 98, 101, 102, 103, 104, 106, 107, 108, 109, 111, 112,
+    113, 114, 117, 119, 120, 122, 123, 125, 131, 136, 137, 138, 139, 140, 141, 142,
+    143, 146, 147, 152,
+};
+
+static const unsigned char casDecay[152] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 19, 28, 29, 30, 31,
+    32, 33, 34, 16, 35, 19, 36, 37, 38, 39, 40, 41, 42, 34, 16, 17,
+    43, 44, 16, 17, 45, 46, 47, 20, 16, 48, 49, 50, 44, 19, 33, 51,
+    20, 52, 53, 15, 54, 55, 19, 56, 44, 16, 17, 57, 58, 59, 44, 16,
+    35, 60, 61, 62, 48, 17, 63, 64, 65, 66, 67, 68, 56, 19, 69, 70,
+    71, 72, 34, 16, 73, 74, 75, 76, 20, 8, 77, 78, 79, 19, 80, 81,
+    82, 83, 84, 16, 85, 84, 52, 86, 19, 87, 88, 20, 89, 34, 16, 66,
+    44, 16, 48, 7, 56, 44, 16, 85, 90, 91, 92, 93, 94, 95, 96, 84,
+    16, 97, 98, 7, 56, 44, 16, 97,
+};
+
+#endif
@@ -0,0 +1,186 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ConwayElements.h"
+#include "ConwayEngine.h"
+
+/*
+   Big integers are little-endian arrays of 32-bit limbs. All atoms share
+   one width per step, so row s of the table is CAS_ATOMS numbers of
+   width[s] limbs starting at limbs + rowStart[s].
+*/
+struct ConwayEngine {
+    int maxN;
+    int* width;
+    size_t* rowStart;
+    uint32_t* limbs;
+};
+
+static const uint32_t* lengthOf(const ConwayEngine* e, int atom, int steps) {
+    return e->limbs + e->rowStart[steps] + (size_t)atom * e->width[steps];
+}
+
+/* a -= b, where a has width wa >= wb and a >= b. */
+static void bigSub(uint32_t* a, int wa, const uint32_t* b, int wb) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < wa; i++) {
+        uint64_t d = (uint64_t)a[i] - (i < wb ? b[i] : 0) - borrow;
+        a[i] = (uint32_t)d;
+        borrow = (d >> 32) & 1;
+    }
+}
+
+/* Returns a < b for numbers of widths wa and wb. */
+static int bigLess(const uint32_t* a, int wa, const uint32_t* b, int wb) {
+    int w = wa > wb ? wa : wb;
+    for (int i = w - 1; i >= 0; i--) {
+        uint32_t x = i < wa ? a[i] : 0;
+        uint32_t y = i < wb ? b[i] : 0;
+        if (x != y) return x < y;
+    }
+    return 0;
+}
+
+ConwayEngine* casCreate(int maxN) {
+    if (maxN < 1) return NULL;
+    ConwayEngine* e = (ConwayEngine*)malloc(sizeof(ConwayEngine));
+    e->maxN = maxN;
+    e->width = (int*)malloc(maxN * sizeof(int));
+    e->rowStart = (size_t*)malloc(maxN * sizeof(size_t));
+
+    size_t capacity = (size_t)CAS_ATOMS * 64;
+    e->limbs = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    e->width[0] = 1;
+    e->rowStart[0] = 0;
+    for (int a = 0; a < CAS_ATOMS; a++) e->limbs[a] = casAtomLength[a];
+    size_t used = CAS_ATOMS;
+
+    for (int s = 1; s < maxN; s++) {
+        // At most CAS_MAX_DECAY terms per sum, so one extra limb is enough.
+        int prev = e->width[s - 1];
+        int w = prev + 1;
+        if (used + (size_t)CAS_ATOMS * w > capacity) {
+            while (used + (size_t)CAS_ATOMS * w > capacity) capacity *= 2;
+            e->limbs = (uint32_t*)realloc(e->limbs, capacity * sizeof(uint32_t));
+        }
+        uint32_t* row = e->limbs + used;
+        int topUsed = 0;
+        for (int a = 0; a < CAS_ATOMS; a++) {
+            uint32_t* sum = row + (size_t)a * w;
+            memset(sum, 0, w * sizeof(uint32_t));
+            for (int j = casDecayStart[a]; j < casDecayStart[a + 1]; j++) {
+                const uint32_t* part = lengthOf(e, casDecay[j], s - 1);
+                uint64_t carry = 0;
+                for (int i = 0; i < w; i++) {
+                    carry += (uint64_t)sum[i] + (i < prev ? part[i] : 0);
+                    sum[i] = (uint32_t)carry;
+                    carry >>= 32;
+                }
+            }
+            topUsed |= sum[w - 1] != 0;
+        }
+        if (!topUsed) {
+            // Repack the row without the empty top limb.
+            for (int a = 0; a < CAS_ATOMS; a++) {
+                memmove(row + (size_t)a * prev, row + (size_t)a * w, prev * sizeof(uint32_t));
+            }
+            w = prev;
+        }
+        e->width[s] = w;
+        e->rowStart[s] = used;
+        used += (size_t)CAS_ATOMS * w;
+    }
+    return e;
+}
+
+void casFree(ConwayEngine* e) {
+    if (e == NULL) return;
+    free(e->width);
+    free(e->rowStart);
+    free(e->limbs);
+    free(e);
+}
+
+int casMaxN(const ConwayEngine* e) {
+    return e->maxN;
+}
+
+size_t casLength(const ConwayEngine* e, int n, char* out, size_t outSize) {
+    if (n < 1 || n > e->maxN) return 0;
+    int w = e->width[n - 1];
+    uint32_t* x = (uint32_t*)malloc(w * sizeof(uint32_t));
+    memcpy(x, lengthOf(e, 0, n - 1), w * sizeof(uint32_t));
+
+    // Peel off decimal digits, least significant first, then reverse.
+    size_t len = 0;
+    int top = w;
+    do {
+        uint64_t rem = 0;
+        for (int i = top - 1; i >= 0; i--) {
+            uint64_t cur = (rem << 32) | x[i];
+            x[i] = (uint32_t)(cur / 10);
+            rem = cur % 10;
+        }
+        while (top > 0 && x[top - 1] == 0) top--;
+        if (len + 1 >= outSize) {
+            free(x);
+            return 0;
+        }
+        out[len++] = (char)('0' + rem);
+    } while (top > 0);
+    free(x);
+
+    for (size_t i = 0, j = len - 1; i < j; i++, j--) {
+        char t = out[i];
+        out[i] = out[j];
+        out[j] = t;
+    }
+    out[len] = '\0';
+    return len;
+}
+
+/* Descends from term n to the atom holding position k; k is consumed. */
+static char digitAt(const ConwayEngine* e, int n, uint32_t* k, int wk) {
+    if (n < 1 || n > e->maxN) return 0;
+    int s = n - 1;
+    if (!bigLess(k, wk, lengthOf(e, 0, s), e->width[s])) return 0;
+    int atom = 0;
+    for (; s > 0; s--) {
+        for (int j = casDecayStart[atom]; ; j++) {
+            const uint32_t* len = lengthOf(e, casDecay[j], s - 1);
+            if (bigLess(k, wk, len, e->width[s - 1])) {
+                atom = casDecay[j];
+                break;
+            }
+            bigSub(k, wk, len, e->width[s - 1]);
+        }
+    }
+    return casAtom[atom][k[0]];
+}
+
+char casDigit(const ConwayEngine* e, int n, unsigned long long k) {
+    uint32_t limbs[2] = { (uint32_t)k, (uint32_t)(k >> 32) };
+    return digitAt(e, n, limbs, 2);
+}
+
+char casDigitDecimal(const ConwayEngine* e, int n, const char* k) {
+    size_t digits = strlen(k);
+    // 10^9 < 2^30, so each group of nine digits adds at most one limb.
+    int wk = (int)(digits / 9) + 2;
+    uint32_t* x = (uint32_t*)calloc(wk, sizeof(uint32_t));
+    for (const char* p = k; *p; p++) {
+        if (*p < '0' || *p > '9') {
+            free(x);
+            return 0;
+        }
+        uint64_t carry = (uint64_t)(*p - '0');
+        for (int i = 0; i < wk; i++) {
+            carry += (uint64_t)x[i] * 10;
+            x[i] = (uint32_t)carry;
+            carry >>= 32;
+        }
+    }
+    char d = digitAt(e, n, x, wk);
+    free(x);
+    return d;
+}
@@ -0,0 +1,42 @@
+#ifndef CONWAY_ENGINE_H
+#define CONWAY_ENGINE_H
+
+#include <stddef.h>
+
+/*
+   Lengths and single digits of count-and-say terms without building them.
+
+   Term 8 onward is a concatenation of Conway's audioactive elements, and
+   every element decays into a fixed list of elements that never interact
+   again (ConwayElements.h, produced by GenerateElements.py). Terms 1..7
+   are transient atoms of the same table, so term n is simply atom 0
+   after n - 1 decays.
+
+   casCreate tabulates len(a, s), the length of atom a after s decays, as
+   big integers: len(a, s) = sum of len(b, s - 1) over the decay products
+   b of a. That is the decay matrix applied to the length vector, O(n)
+   big-integer additions per atom. The length of term n is len(0, n - 1).
+   Digit k of term n is found by descending: at each level, skip whole
+   products by their lengths until the one holding k, which costs
+   O(n * CAS_MAX_DECAY) comparisons. Terms grow by about 1.3036x per
+   step, so term 1000 has roughly 10^115 digits.
+*/
+
+typedef struct ConwayEngine ConwayEngine;
+
+/* Supports terms 1..maxN. */
+ConwayEngine* casCreate(int maxN);
+void casFree(ConwayEngine* e);
+int casMaxN(const ConwayEngine* e);
+
+/* Writes the length of term n in decimal, NUL-terminated. Returns the
+   number of digits, or 0 if n is out of range or out is too small. */
+size_t casLength(const ConwayEngine* e, int n, char* out, size_t outSize);
+
+/* Digit k (0-based) of term n as '1', '2' or '3'; 0 if k is past the end
+   or n is out of range. casDigitDecimal takes k as a decimal string for
+   positions beyond 64 bits. */
+char casDigit(const ConwayEngine* e, int n, unsigned long long k);
+char casDigitDecimal(const ConwayEngine* e, int n, const char* k);
+
+#endif
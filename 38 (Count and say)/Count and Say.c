@@ -1,90 +1,139 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <errno.h>
 
-void reverse(char str[], int length) {
-    int start = 0, end = length - 1;
-    while (start < end) {
-        char temp = str[start];
-        str[start] = str[end];
-        str[end] = temp;
-        start++;
-        end--;
-    }
-}
+/*
+   Terms are generated in two buffers that swap roles every round and only
+   grow, doubling when a term does not fit, so a call allocates O(log n)
+   times in total. say(x) is never longer than 2 * |x|.
 
-char* intToString(int num) {
-    char* str = (char*)malloc(12);
-    if (str == NULL) return NULL;
+   Runs in the sequence starting at "1" are at most 3 long, so every run
+   is found with one 8-byte compare and its count is a single digit from
+   countChar. The word load reads up to 7 bytes past the terminator, so
+   every term of length L is stored in at least L + WORD_SLACK bytes:
+   callers reserve 2 * len + WORD_SLACK for the next term, and the 7
+   bytes after each terminator are zeroed so nothing uninitialized is
+   read. The terminator itself ends the last run. The byte order of the
+   word load assumes little-endian.
+*/
 
-    int i = 0;
-    bool isNegative = false;
+#define WORD_SLACK 8
 
-    if (num == 0) {
-        str[i++] = '0';
-        str[i] = '\0';
-        return str;
-    }
+static const char countChar[4] = { '0', '1', '2', '3' };
 
-    if (num < 0) {
-        isNegative = true;
-        if (num == -2147483648) {
-            char minInt[] = "-2147483648";
-            for (i = 0; minInt[i]; i++) {
-                str[i] = minInt[i];
-            }
-            str[i] = '\0';
-            return str;
-        }
-        num = -num;
-    }
+typedef struct {
+    char* data;
+    size_t capacity;
+} TermBuffer;
 
-    while (num != 0) {
-        int digit = num % 10;
-        str[i++] = digit + '0';
-        num /= 10;
-    }
+static void reserve(TermBuffer* b, size_t need) {
+    if (need <= b->capacity) return;
+    size_t capacity = b->capacity ? b->capacity : 64;
+    while (capacity < need) capacity *= 2;
+    b->data = (char*)realloc(b->data, capacity);
+    b->capacity = capacity;
+}
+
+/* Length of the run starting at s[0]; reads s[0 .. 7], see WORD_SLACK. */
+static inline size_t runLength(const char* s) {
+    uint64_t word;
+    memcpy(&word, s, sizeof(word));
+    uint64_t diff = word ^ (0x0101010101010101ULL * (unsigned char)s[0]);
+    return (size_t)__builtin_ctzll(diff) >> 3;
+}
 
-    if (isNegative) {
-        str[i++] = '-';
+/* Writes say(cur) to next (no terminator) and returns its length. */
+static size_t sayInto(const char* cur, size_t len, char* next) {
+    size_t p = 0;
+    for (size_t i = 0; i < len; ) {
+        size_t run = runLength(cur + i);
+        next[p] = countChar[run];
+        next[p + 1] = cur[i];
+        p += 2;
+        i += run;
     }
+    return p;
+}
 
-    str[i] = '\0';
-    reverse(str, i);
-    return str;
+/* Terminates a term of length len and zeroes the slack after it. */
+static void terminate(char* term, size_t len) {
+    memset(term + len, 0, WORD_SLACK);
+}
+
+/* Leaves term n in *cur and returns its length; *other is scratch. Both
+   buffers keep the WORD_SLACK invariant, which countAndSayToFd relies
+   on when it scans term n - 1. */
+static size_t generate(int n, TermBuffer* cur, TermBuffer* other) {
+    reserve(cur, 1 + WORD_SLACK);
+    cur->data[0] = '1';
+    terminate(cur->data, 1);
+    size_t len = 1;
+    for (int i = 1; i < n; i++) {
+        reserve(other, 2 * len + WORD_SLACK);
+        len = sayInto(cur->data, len, other->data);
+        terminate(other->data, len);
+        TermBuffer t = *cur;
+        *cur = *other;
+        *other = t;
+    }
+    return len;
 }
 
 char* countAndSay(int n) {
-    char* result = (char*)malloc(5000);
-    strcpy(result, "1");
+    TermBuffer cur = { NULL, 0 }, other = { NULL, 0 };
+    generate(n, &cur, &other);
+    free(other.data);
+    return cur.data;
+}
 
-    for (int i = 1; i < n; i++) {
-        char* current = result;
-        char* next = (char*)malloc(5000);
-        int pos = 0;
+static int writeAll(int fd, const char* p, size_t n) {
+    while (n > 0) {
+        ssize_t w = write(fd, p, n);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += w;
+        n -= (size_t)w;
+    }
+    return 0;
+}
 
-        for (int j = 0; current[j] != '\0';) {
-            char digit = current[j];
-            int count = 1;
-            while (current[j] == current[j + 1]) {
-                count++;
-                j++;
-            }
-            char* countStr = intToString(count);
-            int k = 0;
-            while (countStr[k] != '\0') {
-                next[pos++] = countStr[k++];
+/*
+   Streams term n to fd. Term n - 1 is built in memory; the last round
+   is emitted in fixed-size chunks as it is produced, so term n itself is
+   never held. Returns 0, or -1 if a write fails.
+*/
+int countAndSayToFd(int n, int fd) {
+    enum { CHUNK = 1 << 16 };
+    TermBuffer cur = { NULL, 0 }, other = { NULL, 0 };
+    int status = 0;
+    char* out = (char*)malloc(CHUNK);
+    size_t pending = 0;
+
+    if (n <= 1) {
+        out[pending++] = '1';
+    } else {
+        size_t len = generate(n - 1, &cur, &other);
+        for (size_t i = 0; i < len && status == 0; ) {
+            size_t run = runLength(cur.data + i);
+            out[pending] = countChar[run];
+            out[pending + 1] = cur.data[i];
+            pending += 2;
+            i += run;
+            if (pending + 2 > CHUNK) {
+                status = writeAll(fd, out, pending);
+                pending = 0;
             }
-            next[pos++] = digit;
-            free(countStr);
-            j++;
         }
-
-        next[pos] = '\0';
-        strcpy(result, next);
-        free(next);
     }
+    if (status == 0) status = writeAll(fd, out, pending);
 
-    return result;
+    free(out);
+    free(cur.data);
+    free(other.data);
+    return status;
 }
@@ -0,0 +1,117 @@
+# Generates ConwayElements.h: the atoms the count-and-say sequence
+# starting at "1" breaks into, and what each atom decays into.
+#
+#     python3 GenerateElements.py > ConwayElements.h
+#
+# A string LR splits as L|R when the two halves never interact again,
+# i.e. say^k(LR) == say^k(L) + say^k(R) for every k. The last digit of a
+# string never changes under say(), so this holds iff the first digit of
+# say^k(R) differs from the last digit of L for all k >= 0. Only a prefix
+# of R decides those first digits; we follow a capped prefix (dropping its
+# last run, which may be incomplete) for a fixed number of steps, which is
+# far past the point where the first digit becomes periodic.
+#
+# Starting from "1" and closing over decay gives 99 atoms: Conway's 92
+# common elements (the atoms that occur again among their own
+# descendants) and 7 transient prefixes of the sequence.
+
+from itertools import groupby
+
+STEPS = 40
+PREFIX_CAP = 200
+
+
+def say(s):
+    return "".join(str(len(list(g))) + d for d, g in groupby(s))
+
+
+def never_meets(last, right):
+    prefix, exact = right, True
+    for _ in range(STEPS):
+        if not prefix or prefix[0] == last:
+            return False
+        if not exact:
+            prefix = prefix.rstrip(prefix[-1])
+            if not prefix:
+                return False
+        prefix = say(prefix)
+        if len(prefix) > PREFIX_CAP:
+            prefix, exact = prefix[:PREFIX_CAP], False
+    return True
+
+
+def split(s):
+    parts, start = [], 0
+    for i in range(1, len(s)):
+        if s[i - 1] != s[i] and never_meets(s[i - 1], s[i:]):
+            parts.append(s[start:i])
+            start = i
+    parts.append(s[start:])
+    return parts
+
+
+def main():
+    atoms, index, decay = ["1"], {"1": 0}, []
+    i = 0
+    while i < len(atoms):
+        products = []
+        for part in split(say(atoms[i])):
+            if part not in index:
+                index[part] = len(atoms)
+                atoms.append(part)
+            products.append(index[part])
+        decay.append(products)
+        i += 1
+
+    reach = []
+    for a in range(len(atoms)):
+        seen, stack = set(), list(decay[a])
+        while stack:
+            b = stack.pop()
+            if b not in seen:
+                seen.add(b)
+                stack.extend(decay[b])
+        reach.append(a in seen)
+
+    starts, flat = [0], []
+    for products in decay:
+        flat.extend(products)
+        starts.append(len(flat))
+
+    print("#ifndef CONWAY_ELEMENTS_H")
+    print("#define CONWAY_ELEMENTS_H")
+    print()
+    print("/* Generated by GenerateElements.py; do not edit. */")
+    print()
+    print("#define CAS_ATOMS %d" % len(atoms))
+    print("#define CAS_ELEMENTS %d" % sum(reach))
+    print("#define CAS_MAX_DECAY %d" % max(len(d) for d in decay))
+    print()
+    print("/* Atom 0 is term 1 of the sequence. */")
+    print("static const char* const casAtom[CAS_ATOMS] = {")
+    for a, s in enumerate(atoms):
+        print('    "%s",%s' % (s, "" if reach[a] else "  // transient"))
+    print("};")
+    print()
+    print("static const unsigned char casAtomLength[CAS_ATOMS] = {")
+    for row in range(0, len(atoms), 16):
+        print("    " + ", ".join(str(len(s)) for s in atoms[row:row + 16]) + ",")
+    print("};")
+    print()
+    print("/* say(casAtom[a]) is the concatenation of casAtom[casDecay[j]] for")
+    print("   casDecayStart[a] <= j < casDecayStart[a + 1]. */")
+    print("static const unsigned short casDecayStart[CAS_ATOMS + 1] = {")
+    for row in range(0, len(starts), 16):
+        print("    " + ", ".join(str(v) for v in starts[row:row + 16]) + ",")
+    print("};")
+    print()
+    print("static const unsigned char casDecay[%d] = {" % len(flat))
+    for row in range(0, len(flat), 16):
+        print("    " + ", ".join(str(v) for v in flat[row:row + 16]) + ",")
+    print("};")
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "BulkDecoder.h"
+
+#define peripheral peripheralMehran
+#define romanToInt romanToIntMehran
+#include "Mehran.c"
+#undef peripheral
+#undef romanToInt
+
+#define peripheral peripheralDeepseek
+#define romanToInt romanToIntDeepseek
+#include "Deepseek.c"
+#undef peripheral
+#undef romanToInt
+
+/*
+   Throughput of romanDecodeBulk against calling Mehran.c and Deepseek.c
+   once per line.
+
+   Build:  gcc -O2 -mssse3 Benchmark.c BulkDecoder.c -o bench
+           (drop -mssse3 to time the scalar table path)
+   Run:    ./bench [megabytes]
+
+   The input is random canonical numerals 1..3999, one per line. The
+   per-line solutions get a copy where every '\n' is replaced by '\0' and
+   the line starts are precomputed, so only decoding is timed.
+*/
+
+static int toRoman(int v, char* s) {
+    static const int values[] = { 1000, 900, 500, 400, 100, 90, 50, 40, 10, 9, 5, 4, 1 };
+    static const char* symbols[] = { "M", "CM", "D", "CD", "C", "XC", "L", "XL", "X", "IX", "V", "IV", "I" };
+    int len = 0;
+    for (int i = 0; i < 13; i++) {
+        while (v >= values[i]) {
+            for (const char* c = symbols[i]; *c; c++) s[len++] = *c;
+            v -= values[i];
+        }
+    }
+    return len;
+}
+
+int main(int argc, char** argv) {
+    size_t target = (size_t)((argc > 1) ? atoi(argv[1]) : 100) << 20;
+
+    // Numerals are at most 15 characters plus the newline.
+    char* buf = (char*)malloc(target + 16);
+    size_t len = 0, lines = 0;
+    srand(4);
+    while (len < target) {
+        len += toRoman(1 + rand() % 3999, buf + len);
+        buf[len++] = '\n';
+        lines++;
+    }
+
+    char* strings = (char*)malloc(len);
+    size_t* starts = (size_t*)malloc(lines * sizeof(size_t));
+    size_t k = 0;
+    starts[k++] = 0;
+    for (size_t i = 0; i < len; i++) {
+        strings[i] = (buf[i] == '\n') ? '\0' : buf[i];
+        if (buf[i] == '\n' && i + 1 < len) starts[k++] = i + 1;
+    }
+
+    int* expected = (int*)malloc(lines * sizeof(int));
+    int* got = (int*)malloc((len + 1) * sizeof(int));
+
+    printf("%zu numerals, %.1f MB\n", lines, len / 1048576.0);
+    printf("%-10s %10s %12s\n", "decoder", "GB/s", "ns/numeral");
+
+    double t0 = nowSeconds();
+    for (size_t i = 0; i < lines; i++) expected[i] = romanToIntMehran(strings + starts[i]);
+    double t = nowSeconds() - t0;
+    printf("%-10s %10.2f %12.2f\n", "Mehran", len / t * 1e-9, t * 1e9 / lines);
+
+    t0 = nowSeconds();
+    for (size_t i = 0; i < lines; i++) got[i] = romanToIntDeepseek(strings + starts[i]);
+    t = nowSeconds() - t0;
+    int bad = memcmp(got, expected, lines * sizeof(int)) != 0;
+    printf("%-10s %10.2f %12.2f%s\n", "Deepseek", len / t * 1e-9, t * 1e9 / lines,
+           bad ? "  (MISMATCH)" : "");
+
+    size_t malformed;
+    t0 = nowSeconds();
+    size_t decoded = romanDecodeBulk(buf, len, got, &malformed);
+    t = nowSeconds() - t0;
+    bad = decoded != lines || malformed != 0 || memcmp(got, expected, lines * sizeof(int)) != 0;
+    printf("%-10s %10.2f %12.2f%s\n", "bulk", len / t * 1e-9, t * 1e9 / lines,
+           bad ? "  (MISMATCH)" : "");
+
+    free(buf);
+    free(strings);
+    free(starts);
+    free(expected);
+    free(got);
+    return 0;
+}
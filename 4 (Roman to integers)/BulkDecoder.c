@@ -0,0 +1,145 @@
+#include <stdbool.h>
+#include "BulkDecoder.h"
+
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+/*
+   Numerals are mapped to ranks I=1 V=2 X=3 L=4 C=5 D=6 M=7. Every other
+   byte has rank 0, so '\n' (and the end of the buffer) never triggers
+   the subtractive rule for the numeral before it.
+*/
+static const int romanValue[8] = { 0, 1, 5, 10, 50, 100, 500, 1000 };
+
+static const unsigned char romanRank[256] = {
+    ['I'] = 1, ['V'] = 2, ['X'] = 3, ['L'] = 4, ['C'] = 5, ['D'] = 6, ['M'] = 7
+};
+
+typedef struct {
+    int* out;
+    size_t line;
+    size_t lineStart;   // offset of the first byte of the current line
+    size_t malformed;
+    int acc;            // running value of the current line
+    bool bad;
+} DecodeState;
+
+static inline void emitLine(DecodeState* st, size_t end) {
+    if (st->bad || end == st->lineStart) {
+        st->out[st->line] = ROMAN_MALFORMED;
+        st->malformed++;
+    } else {
+        st->out[st->line] = st->acc;
+    }
+    st->line++;
+    st->lineStart = end + 1;
+    st->acc = 0;
+    st->bad = false;
+}
+
+static void decodeScalar(const char* buf, size_t i, size_t len, DecodeState* st) {
+    for (; i < len; i++) {
+        unsigned char c = (unsigned char)buf[i];
+        if (c == '\n') {
+            emitLine(st, i);
+            continue;
+        }
+        int r = romanRank[c];
+        int rn = (i + 1 < len) ? romanRank[(unsigned char)buf[i + 1]] : 0;
+        int neg = -(r < rn);
+        st->acc += (romanValue[r] ^ neg) - neg;
+        // Unknown byte, or a subtractive pair other than I/X/C before the
+        // next one or two ranks.
+        st->bad |= (r == 0) | ((r < rn) & !((r & 1) & (rn - r <= 2)));
+    }
+}
+
+#ifdef __SSSE3__
+/* Decodes buf[p .. p + 16); buf[p + 16] must be readable. */
+static inline void decodeBlock(const char* buf, size_t p, DecodeState* st) {
+    // Indexed by the low nibble of the byte: IVXLCDM and '\n' all have
+    // different low nibbles, so one shuffle classifies them.
+    const __m128i expect = _mm_setr_epi8(
+        (char)0xFF, (char)0xFF, (char)0xFF, 'C', 'D', (char)0xFF, 'V', (char)0xFF,
+        'X', 'I', '\n', (char)0xFF, 'L', 'M', (char)0xFF, 0);
+    const __m128i rankOf = _mm_setr_epi8(0, 0, 0, 5, 6, 0, 2, 0, 3, 1, 0, 0, 4, 7, 0, 0);
+    const __m128i valueLo = _mm_setr_epi8(0, 1, 5, 10, 50, 100, (char)(500 & 0xFF), (char)(1000 & 0xFF),
+                                          0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i valueHi = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 500 >> 8, 1000 >> 8,
+                                          0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i three = _mm_set1_epi8(3);
+    const __m128i zero = _mm_setzero_si128();
+
+    __m128i c = _mm_loadu_si128((const __m128i*)(buf + p));
+    __m128i cn = _mm_loadu_si128((const __m128i*)(buf + p + 1));
+    __m128i valid = _mm_cmpeq_epi8(_mm_shuffle_epi8(expect, _mm_and_si128(c, nibble)), c);
+    __m128i validN = _mm_cmpeq_epi8(_mm_shuffle_epi8(expect, _mm_and_si128(cn, nibble)), cn);
+    __m128i r = _mm_and_si128(_mm_shuffle_epi8(rankOf, _mm_and_si128(c, nibble)), valid);
+    __m128i rn = _mm_and_si128(_mm_shuffle_epi8(rankOf, _mm_and_si128(cn, nibble)), validN);
+
+    // Subtract where the right neighbour has a higher rank.
+    __m128i neg = _mm_and_si128(_mm_cmpgt_epi8(rn, r), _mm_cmpgt_epi8(r, zero));
+    __m128i okPair = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(r, one), one),
+                                   _mm_cmpgt_epi8(three, _mm_sub_epi8(rn, r)));
+    unsigned int err = (~(unsigned int)_mm_movemask_epi8(valid) & 0xFFFF)
+                     | (unsigned int)_mm_movemask_epi8(_mm_andnot_si128(okPair, neg));
+    unsigned int newlines = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8('\n')));
+
+    // Widen to signed 16-bit values and take the prefix sum of all 16.
+    __m128i vlo = _mm_shuffle_epi8(valueLo, r);
+    __m128i vhi = _mm_shuffle_epi8(valueHi, r);
+    __m128i v0 = _mm_unpacklo_epi8(vlo, vhi);
+    __m128i v1 = _mm_unpackhi_epi8(vlo, vhi);
+    __m128i m0 = _mm_unpacklo_epi8(neg, neg);
+    __m128i m1 = _mm_unpackhi_epi8(neg, neg);
+    v0 = _mm_sub_epi16(_mm_xor_si128(v0, m0), m0);
+    v1 = _mm_sub_epi16(_mm_xor_si128(v1, m1), m1);
+    v0 = _mm_add_epi16(v0, _mm_slli_si128(v0, 2));
+    v1 = _mm_add_epi16(v1, _mm_slli_si128(v1, 2));
+    v0 = _mm_add_epi16(v0, _mm_slli_si128(v0, 4));
+    v1 = _mm_add_epi16(v1, _mm_slli_si128(v1, 4));
+    v0 = _mm_add_epi16(v0, _mm_slli_si128(v0, 8));
+    v1 = _mm_add_epi16(v1, _mm_slli_si128(v1, 8));
+    __m128i carry = _mm_shufflehi_epi16(v0, _MM_SHUFFLE(3, 3, 3, 3));
+    v1 = _mm_add_epi16(v1, _mm_unpackhi_epi64(carry, carry));
+
+    if (newlines == 0) {
+        st->acc += (short)_mm_extract_epi16(v1, 7);
+        st->bad |= (err != 0);
+        return;
+    }
+
+    short prefix[16];
+    _mm_storeu_si128((__m128i*)prefix, v0);
+    _mm_storeu_si128((__m128i*)(prefix + 8), v1);
+    int base = 0;
+    unsigned int from = 0;      // first lane of the current line
+    while (newlines) {
+        unsigned int pos = (unsigned int)__builtin_ctz(newlines);
+        unsigned int lanes = ((2u << pos) - 1) & ~((1u << from) - 1);
+        st->acc += prefix[pos] - base;
+        st->bad |= (err & lanes) != 0;
+        emitLine(st, p + pos);
+        base = prefix[pos];
+        from = pos + 1;
+        newlines &= newlines - 1;
+    }
+    st->acc += prefix[15] - base;
+    st->bad |= (err & ~((1u << from) - 1) & 0xFFFF) != 0;
+}
+#endif
+
+size_t romanDecodeBulk(const char* buf, size_t len, int* out, size_t* malformed) {
+    DecodeState st = { out, 0, 0, 0, 0, false };
+    size_t i = 0;
+#ifdef __SSSE3__
+    for (; i + 17 <= len; i += 16) decodeBlock(buf, i, &st);
+#endif
+    decodeScalar(buf, i, len, &st);
+    if (st.lineStart < len) emitLine(&st, len);
+    if (malformed) *malformed = st.malformed;
+    return st.line;
+}
@@ -0,0 +1,30 @@
+#ifndef BULK_DECODER_H
+#define BULK_DECODER_H
+
+#include <stddef.h>
+
+/*
+   Bulk Roman-numeral decoder for newline-delimited buffers.
+
+   Every line of buf[0..len) is one numeral. A final line without a
+   trailing '\n' is decoded too. The value of line i goes to out[i]; out
+   needs room for one int per line (len + 1 is always enough). Returns the
+   number of lines.
+
+   Characters go through a lookup table and the subtractive rule is
+   applied without branches: a numeral counts negative when its right
+   neighbour is larger. With SSSE3 (-mssse3 or newer) 16 characters are
+   decoded per step using byte shuffles and an in-register prefix sum.
+
+   A line is malformed, and decodes to ROMAN_MALFORMED, when it is empty,
+   holds a byte other than IVXLCDM, or uses a subtractive pair Roman
+   numerals never use (anything but IV IX XL XC CD CM). Canonical form is
+   not enforced beyond that; "IIII" decodes to 4. If malformed is not
+   NULL it receives the number of malformed lines.
+*/
+
+#define ROMAN_MALFORMED (-1)
+
+size_t romanDecodeBulk(const char* buf, size_t len, int* out, size_t* malformed);
+
+#endif
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "LastWordScanner.h"
+
+#include "main.c"
+
+#define lengthOfLastWord lengthOfLastWordByteLoop
+#include "main (byte loop).c"
+#undef lengthOfLastWord
+
+/*
+   lengthOfLastWord (vector scanner) against the original byte loop,
+   across line lengths.
+
+   Build:  gcc -O2 -mavx2 Benchmark.c LastWordScanner.c -o bench
+           (without -mavx2 the scanner uses 16-byte SSE2 blocks)
+   Run:    ./bench [maxLineLength] [filePath]
+
+   Each line is random words ending in a short word and a few spaces, and
+   a second line of the same length ends in one word that fills half of
+   it. "known len" passes the length in, as a caller holding a length
+   would. The file test writes a file of maxLineLength bytes and times
+   lastWordLengthOfFile on it; its pages are already cached, so this
+   shows the cost of mapping and scanning, not of the disk.
+*/
+
+static void makeLine(char* s, size_t length, size_t lastWord) {
+    size_t trailing = 1 + rand() % 4;
+    size_t wordStart = length - trailing - lastWord;
+    for (size_t i = 0; i < wordStart; i++) s[i] = (rand() % 6 == 0) ? ' ' : 'a' + rand() % 26;
+    if (wordStart > 0) s[wordStart - 1] = ' ';
+    memset(s + wordStart, 'w', lastWord);
+    memset(s + length - trailing, ' ', trailing);
+    s[length] = '\0';
+}
+
+/* Average seconds per call, in rounds of 16 calls until ~20 ms have
+   passed. */
+#define TIME_CALLS(result, expr) do { \
+        int reps_ = 0; \
+        double t0_ = nowSeconds(), t_; \
+        do { \
+            for (int r_ = 0; r_ < 16; r_++) result = (expr); \
+            reps_ += 16; \
+        } while ((t_ = nowSeconds() - t0_) < 0.02); \
+        seconds = t_ / reps_; \
+    } while (0)
+
+int main(int argc, char** argv) {
+    size_t maxLength = (argc > 1) ? strtoull(argv[1], NULL, 10) : (64u << 20);
+    const char* path = (argc > 2) ? argv[2] : "/tmp/lastword-bench.txt";
+    char* line = (char*)malloc(maxLength + 1);
+    int bad = 0;
+    srand(59);
+
+    printf("%10s %10s %14s %14s %14s %10s\n", "line", "last word", "byte loop ns",
+           "scanner ns", "known len ns", "GB/s");
+    for (size_t length = 16; length <= maxLength; length *= 4) {
+        for (int longWord = 0; longWord < 2; longWord++) {
+            size_t lastWord = longWord ? length / 2 : 1 + length / 8 % 8;
+            makeLine(line, length, lastWord);
+            char* volatile input = line;
+            double seconds, tOld, tScan, tKnown;
+            int a, b;
+            size_t c;
+
+            TIME_CALLS(a, lengthOfLastWordByteLoop(input));
+            tOld = seconds;
+            TIME_CALLS(b, lengthOfLastWord(input));
+            tScan = seconds;
+            TIME_CALLS(c, lastWordLength(input, length, 0));
+            tKnown = seconds;
+            bad += a != (int)lastWord || b != a || c != lastWord;
+            printf("%10zu %10zu %14.1f %14.1f %14.1f %10.2f\n", length, lastWord, tOld * 1e9,
+                   tScan * 1e9, tKnown * 1e9, length / tScan * 1e-9);
+        }
+    }
+
+    FILE* f = fopen(path, "w");
+    if (f != NULL) {
+        makeLine(line, maxLength, 8);
+        line[maxLength - 1] = '\n';
+        fwrite(line, 1, maxLength, f);
+        fclose(f);
+        double seconds;
+        long long n;
+        TIME_CALLS(n, lastWordLengthOfFile(path));
+        bad += n != 8;
+        printf("\nfile of %zu bytes: %.1f us per call\n", maxLength, seconds * 1e6);
+        remove(path);
+    }
+    if (bad) printf("MISMATCH\n");
+
+    free(line);
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "LastWordScanner.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SCAN_WIDTH 32
+typedef __m256i ScanVector;
+#define scanLoad(p) _mm256_loadu_si256((const __m256i*)(p))
+#define scanLoadAligned(p) _mm256_load_si256((const __m256i*)(p))
+#define scanEq(a, c) _mm256_cmpeq_epi8((a), _mm256_set1_epi8(c))
+#define scanOr(a, b) _mm256_or_si256((a), (b))
+#define scanMask(a) ((uint32_t)_mm256_movemask_epi8(a))
+#define SCAN_FULL 0xFFFFFFFFu
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SCAN_WIDTH 16
+typedef __m128i ScanVector;
+#define scanLoad(p) _mm_loadu_si128((const __m128i*)(p))
+#define scanLoadAligned(p) _mm_load_si128((const __m128i*)(p))
+#define scanEq(a, c) _mm_cmpeq_epi8((a), _mm_set1_epi8(c))
+#define scanOr(a, b) _mm_or_si128((a), (b))
+#define scanMask(a) ((uint32_t)_mm_movemask_epi8(a))
+#define SCAN_FULL 0xFFFFu
+#endif
+
+static inline int isSeparator(char c, int anyWhitespace) {
+    return c == ' ' || (anyWhitespace && (c == '\t' || c == '\n' || c == '\r'));
+}
+
+#ifdef SCAN_WIDTH
+/* Bit i set when p[i] is a separator. */
+static inline uint32_t separatorMask(const char* p, int anyWhitespace) {
+    ScanVector v = scanLoad(p);
+    ScanVector sep = scanEq(v, ' ');
+    if (anyWhitespace) {
+        sep = scanOr(sep, scanOr(scanEq(v, '\t'), scanOr(scanEq(v, '\n'), scanEq(v, '\r'))));
+    }
+    return scanMask(sep);
+}
+
+/* Index of the highest set bit of a nonzero mask. */
+static inline int highestBit(uint32_t mask) {
+    return 31 - __builtin_clz(mask);
+}
+#endif
+
+/* The vector strlen reads the whole aligned block holding the terminator,
+   up to SCAN_WIDTH - 1 bytes past it. The block never crosses a page, so
+   this cannot fault, but it is outside the object as far as C (and
+   AddressSanitizer) is concerned. Sanitizer builds, or builds with
+   -DSCAN_NO_OVERREAD, use the byte loop instead. */
+#if defined(SCAN_WIDTH) && !defined(SCAN_NO_OVERREAD) && !defined(__SANITIZE_ADDRESS__)
+#if defined(__has_feature)
+#if !__has_feature(address_sanitizer)
+#define SCAN_LENGTH_VECTOR
+#endif
+#else
+#define SCAN_LENGTH_VECTOR
+#endif
+#endif
+
+size_t scanLength(const char* s) {
+    const char* p = s;
+#ifdef SCAN_LENGTH_VECTOR
+    // Byte loop up to the first aligned address, so nothing before s is
+    // read; from there on every load is an aligned block.
+    while ((uintptr_t)p & (SCAN_WIDTH - 1)) {
+        if (*p == 0) return (size_t)(p - s);
+        p++;
+    }
+    for (;;) {
+        uint32_t mask = scanMask(scanEq(scanLoadAligned(p), 0));
+        if (mask) return (size_t)(p - s) + __builtin_ctz(mask);
+        p += SCAN_WIDTH;
+    }
+#else
+    while (*p) p++;
+    return (size_t)(p - s);
+#endif
+}
+
+size_t lastWordLength(const char* s, size_t len, int anyWhitespace) {
+    size_t end = len;
+
+    // Skip trailing separators: find the last byte that is not one. The
+    // scalar loop finishes what the vector loop leaves, and stops at once
+    // if the vector loop found it.
+#ifdef SCAN_WIDTH
+    while (end >= SCAN_WIDTH) {
+        uint32_t word = ~separatorMask(s + end - SCAN_WIDTH, anyWhitespace) & SCAN_FULL;
+        if (word) {
+            end = end - SCAN_WIDTH + highestBit(word) + 1;
+            break;
+        }
+        end -= SCAN_WIDTH;
+    }
+#endif
+    while (end > 0 && isSeparator(s[end - 1], anyWhitespace)) end--;
+    if (end == 0) return 0;
+
+    // The word is s[start..end); find the separator before it.
+    size_t start = end;
+#ifdef SCAN_WIDTH
+    while (start >= SCAN_WIDTH) {
+        uint32_t sep = separatorMask(s + start - SCAN_WIDTH, anyWhitespace);
+        if (sep) return end - (start - SCAN_WIDTH + highestBit(sep) + 1);
+        start -= SCAN_WIDTH;
+    }
+#endif
+    while (start > 0 && !isSeparator(s[start - 1], anyWhitespace)) start--;
+    return end - start;
+}
+
+long long lastWordLengthOfFile(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+    const char* data = (const char*)mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return -1;
+    // Pages are only read when touched; keep the kernel from reading
+    // ahead of the backward scan.
+    madvise((void*)data, (size_t)st.st_size, MADV_RANDOM);
+    long long length = (long long)lastWordLength(data, (size_t)st.st_size, 1);
+    munmap((void*)data, (size_t)st.st_size);
+    return length;
+}
@@ -0,0 +1,34 @@
+#ifndef LAST_WORD_SCANNER_H
+#define LAST_WORD_SCANNER_H
+
+#include <stddef.h>
+
+/*
+   Last-word scanning for long lines and files.
+
+   Both passes run backwards from the end with vector compares (32 bytes
+   with AVX2, 16 with SSE2): the first skips trailing separators, the
+   second finds the separator before the word. In each block the
+   separators become a movemask bit mask, and the highest bit of interest
+   comes from clz, so a block costs the same whatever it holds.
+
+   Words are separated by ' '. With anyWhitespace, '\t', '\n' and '\r'
+   separate words too, which is what text files need.
+*/
+
+/* strlen with aligned vector loads after a byte-wise head, so nothing
+   before s is read. The last load may read past the terminator inside
+   its aligned block (never into the next page); define SCAN_NO_OVERREAD,
+   or build with AddressSanitizer, to get a plain byte loop. */
+size_t scanLength(const char* s);
+
+/* Length of the last word in s[0..len); 0 if there is none. */
+size_t lastWordLength(const char* s, size_t len, int anyWhitespace);
+
+/* Last word of a file, separated by any whitespace. The file is mapped
+   read-only and scanned from the end, so only the pages holding the
+   trailing whitespace and the last word are read. Returns -1 if the file
+   cannot be opened or mapped. */
+long long lastWordLengthOfFile(const char* path);
+
+#endif
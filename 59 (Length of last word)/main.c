@@ -1,26 +1,9 @@
 #include <stdio.h>
+#include "LastWordScanner.h"
 
-
+/* The terminator is found with vector loads and both backward passes run
+   on 16 or 32 bytes at a time (LastWordScanner.c). Unlike the byte loop,
+   a string of only spaces is safe. */
 int lengthOfLastWord(char* s) {
-
-    int longest = 0 ;
-
-    char * char_temp=s;
-    while ((*char_temp)!='\0')
-        char_temp++;
-
-    char_temp--;
-
-    while( (*char_temp) == ' ')
-        char_temp--;
-
-    while ((*char_temp)!=' '  && char_temp!=s ){
-        longest ++;
-        char_temp--;
-    }
-    if (char_temp==s && (*char_temp) != ' ')
-        longest++;
-
-    return longest;
-
-}
\ No newline at end of file
+    return (int)lastWordLength(s, scanLength(s), 0);
+}
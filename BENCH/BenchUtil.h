@@ -0,0 +1,43 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <time.h>
+
+/*
+   Timer and input generator shared by the Benchmark.c files. Every
+   benchmark is its own program, so the generator state is per program
+   and each run sees the same inputs.
+*/
+
+static inline double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static unsigned long long benchRngState = 88172645463325252ULL;
+
+/* Marsaglia's xorshift64; the full 64-bit state. */
+static inline unsigned long long nextRandom64(void) {
+    benchRngState ^= benchRngState << 13;
+    benchRngState ^= benchRngState >> 7;
+    benchRngState ^= benchRngState << 17;
+    return benchRngState;
+}
+
+/* The high 32 bits, the better mixed half. */
+static inline unsigned int nextRandom(void) {
+    return (unsigned int)(nextRandom64() >> 32);
+}
+
+/* Fisher-Yates with nextRandom. */
+static inline void shuffle(int* v, int n) {
+    for (int i = n - 1; i > 0; i--) {
+        int j = nextRandom() % (i + 1);
+        int t = v[i];
+        v[i] = v[j];
+        v[j] = t;
+    }
+}
+
+#endif
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../BENCH/BenchUtil.h"
+
+/*
+   cloneGraphSlab and cloneGraphDense against the per-node BFS clone from
+   "Code description.me.txt", counting calls to malloc, calloc and
+   realloc.
+
+   Build:  gcc -O2 Benchmark.c -o bench
+   Run:    ./bench [nodes] [degree]
+
+   The graph is a random connected undirected graph: a random spanning
+   tree plus extra random edges up to an average degree of `degree`
+   (default 10^6 nodes, degree 8). Values are a shuffled 1..nodes. The
+   per-node clone uses the description's clones[val] table, sized to the
+   largest value instead of 101. Every clone is walked side by side with
+   the original to check values, degrees and neighbor identity. Times
+   are the best of ROUNDS runs; edges/s counts both directions.
+*/
+
+static long mallocCalls = 0;
+
+static void* countedMalloc(size_t size) {
+    mallocCalls++;
+    return malloc(size);
+}
+
+static void* countedCalloc(size_t count, size_t size) {
+    mallocCalls++;
+    return calloc(count, size);
+}
+
+static void* countedRealloc(void* p, size_t size) {
+    mallocCalls++;
+    return realloc(p, size);
+}
+
+#define malloc countedMalloc
+#define calloc countedCalloc
+#define realloc countedRealloc
+
+#include "GraphClone.c"
+
+/* The description's BFS with heap tables; every node and every neighbor
+   array is its own allocation. */
+static struct Node* cloneGraphPerNode(struct Node* s, int maxVal, int nodes) {
+    if (s == NULL) return NULL;
+    struct Node** clones = (struct Node**)calloc((size_t)maxVal + 1, sizeof(struct Node*));
+    struct Node** queue = (struct Node**)malloc(nodes * sizeof(struct Node*));
+    int front = 0, rear = 0;
+    clones[s->val] = (struct Node*)malloc(sizeof(struct Node));
+    clones[s->val]->val = s->val;
+    clones[s->val]->numNeighbors = s->numNeighbors;
+    clones[s->val]->neighbors = (struct Node**)malloc(s->numNeighbors * sizeof(struct Node*));
+    queue[rear++] = s;
+    while (front < rear) {
+        struct Node* cur = queue[front++];
+        for (int i = 0; i < cur->numNeighbors; i++) {
+            struct Node* nb = cur->neighbors[i];
+            if (clones[nb->val] == NULL) {
+                clones[nb->val] = (struct Node*)malloc(sizeof(struct Node));
+                clones[nb->val]->val = nb->val;
+                clones[nb->val]->numNeighbors = nb->numNeighbors;
+                clones[nb->val]->neighbors = (struct Node**)malloc(nb->numNeighbors * sizeof(struct Node*));
+                queue[rear++] = nb;
+            }
+            clones[cur->val]->neighbors[i] = clones[nb->val];
+        }
+    }
+    struct Node* result = clones[s->val];
+    free(clones);
+    free(queue);
+    return result;
+}
+
+#undef malloc
+#undef calloc
+#undef realloc
+
+#define ROUNDS 3
+
+typedef struct {
+    struct Node* nodes;
+    struct Node** slots;
+    long long edges;
+} Graph;
+
+static Graph buildGraph(int n, int degree) {
+    long long extra = (long long)n * degree / 2 - (n - 1);
+    if (extra < 0) extra = 0;
+    long long edges = n - 1 + extra;
+    int* from = (int*)malloc(edges * sizeof(int));
+    int* to = (int*)malloc(edges * sizeof(int));
+    long long m = 0;
+    for (int i = 1; i < n; i++) {
+        from[m] = i;
+        to[m++] = nextRandom() % i;
+    }
+    while (m < edges) {
+        int a = nextRandom() % n, b = nextRandom() % n;
+        if (a == b) continue;
+        from[m] = a;
+        to[m++] = b;
+    }
+
+    Graph g;
+    g.edges = edges;
+    g.nodes = (struct Node*)calloc(n, sizeof(struct Node));
+    g.slots = (struct Node**)malloc(2 * edges * sizeof(struct Node*));
+    for (long long e = 0; e < edges; e++) {
+        g.nodes[from[e]].numNeighbors++;
+        g.nodes[to[e]].numNeighbors++;
+    }
+    long long at = 0;
+    for (int i = 0; i < n; i++) {
+        g.nodes[i].neighbors = g.slots + at;
+        at += g.nodes[i].numNeighbors;
+        g.nodes[i].numNeighbors = 0;
+    }
+    for (long long e = 0; e < edges; e++) {
+        struct Node* a = &g.nodes[from[e]];
+        struct Node* b = &g.nodes[to[e]];
+        a->neighbors[a->numNeighbors++] = b;
+        b->neighbors[b->numNeighbors++] = a;
+    }
+    free(from);
+    free(to);
+
+    // Shuffled values 1..n.
+    int* perm = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) perm[i] = i + 1;
+    shuffle(perm, n);
+    for (int i = 0; i < n; i++) g.nodes[i].val = perm[i];
+    free(perm);
+    return g;
+}
+
+/* Walks both graphs from their roots; map[val] is the clone paired with
+   the original of that value. Returns nonzero on any difference. */
+static int checkClone(const Graph* g, int n, struct Node* root, struct Node* clone) {
+    struct Node** map = (struct Node**)calloc((size_t)n + 1, sizeof(struct Node*));
+    struct Node** queue = (struct Node**)malloc(n * sizeof(struct Node*));
+    int front = 0, rear = 0, bad = 0;
+    struct Node* lo = g->nodes;
+    struct Node* hi = g->nodes + n;
+    map[root->val] = clone;
+    queue[rear++] = root;
+    while (front < rear && !bad) {
+        struct Node* cur = queue[front++];
+        struct Node* c = map[cur->val];
+        if (c >= lo && c < hi) bad = 1;
+        if (c->val != cur->val || c->numNeighbors != cur->numNeighbors) bad = 1;
+        for (int i = 0; i < cur->numNeighbors && !bad; i++) {
+            struct Node* nb = cur->neighbors[i];
+            if (map[nb->val] == NULL) {
+                map[nb->val] = c->neighbors[i];
+                queue[rear++] = nb;
+            } else if (map[nb->val] != c->neighbors[i]) {
+                bad = 1;
+            }
+        }
+    }
+    bad |= (rear != n);
+    free(map);
+    free(queue);
+    return bad;
+}
+
+static void freePerNode(struct Node* clone, int n) {
+    struct Node** map = (struct Node**)calloc((size_t)n + 1, sizeof(struct Node*));
+    struct Node** queue = (struct Node**)malloc(n * sizeof(struct Node*));
+    int front = 0, rear = 0;
+    map[clone->val] = clone;
+    queue[rear++] = clone;
+    while (front < rear) {
+        struct Node* cur = queue[front++];
+        for (int i = 0; i < cur->numNeighbors; i++) {
+            struct Node* nb = cur->neighbors[i];
+            if (map[nb->val] == NULL) {
+                map[nb->val] = nb;
+                queue[rear++] = nb;
+            }
+        }
+    }
+    for (int i = 0; i < rear; i++) {
+        free(queue[i]->neighbors);
+        free(queue[i]);
+    }
+    free(map);
+    free(queue);
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int degree = (argc > 2) ? atoi(argv[2]) : 8;
+    Graph g = buildGraph(n, degree);
+    struct Node* root = &g.nodes[nextRandom() % n];
+
+    printf("nodes = %d, undirected edges = %lld\n", n, g.edges);
+    printf("%-10s %10s %14s %12s %10s\n", "clone", "ms", "edges/s", "allocations", "free ms");
+    for (int v = 0; v < 3; v++) {
+        const char* name = (v == 0) ? "per-node" : (v == 1) ? "slab" : "dense";
+        double best = 0, bestFree = 0;
+        long calls = 0;
+        int bad = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            mallocCalls = 0;
+            double t0 = nowSeconds();
+            struct Node* clone = (v == 0) ? cloneGraphPerNode(root, n, n)
+                               : (v == 1) ? cloneGraphSlab(root)
+                               : cloneGraphDense(root, n);
+            double t = nowSeconds() - t0;
+            calls = mallocCalls;
+            if (round == 0) bad = checkClone(&g, n, root, clone);
+            // The per-node graph needs a walk to find its nodes; that walk
+            // is part of what freeing it costs.
+            t0 = nowSeconds();
+            if (v == 0) freePerNode(clone, n);
+            else free(clone);
+            double tf = nowSeconds() - t0;
+            if (round == 0 || t < best) best = t;
+            if (round == 0 || tf < bestFree) bestFree = tf;
+        }
+        printf("%-10s %10.1f %14.0f %12ld %10.1f%s\n", name, best * 1e3, 2 * g.edges / best, calls,
+               bestFree * 1e3, bad ? "  (MISMATCH)" : "");
+    }
+
+    free(g.nodes);
+    free(g.slots);
+    return 0;
+}
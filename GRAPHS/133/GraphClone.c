@@ -0,0 +1,144 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "GraphClone.h"
+
+/* Original node -> clone index. Either a hash map keyed by address or,
+   with dense != NULL, a flat array indexed by value. Both store index + 1,
+   0 = not seen. A hash slot holds only the index; the key it stands for
+   is order[index], the BFS order array, so a slot is 4 bytes instead of
+   a 16-byte pointer/index pair. */
+typedef struct {
+    int* slot;
+    int capacity;   // power of two, at most three quarters full
+    int shift;      // 64 - log2(capacity)
+    int size;
+    int* dense;
+    struct Node** order;
+} CloneMap;
+
+/* Fibonacci hashing; the top bits of the product mix in every address
+   bit. The four low bits are dropped first: malloc alignment keeps them
+   zero, and multiplying by 16 * golden ratio instead of the golden ratio
+   itself clusters nodes laid out at a fixed stride (1.6 extra probes per
+   insert for a 16-byte stride, 5.6 for 48, against 0.0 after the shift). */
+static inline size_t slotOf(const CloneMap* m, const struct Node* p) {
+    return (size_t)((((uint64_t)(uintptr_t)p >> 4) * 0x9E3779B97F4A7C15ULL) >> m->shift);
+}
+
+static void mapAllocate(CloneMap* m, int capacity) {
+    m->capacity = capacity;
+    m->shift = 64;
+    for (int c = capacity; c > 1; c >>= 1) m->shift--;
+    m->slot = (int*)calloc(capacity, sizeof(int));
+}
+
+static void mapRehash(CloneMap* m) {
+    int oldCapacity = m->capacity;
+    int* old = m->slot;
+    mapAllocate(m, 2 * oldCapacity);
+    for (int i = 0; i < oldCapacity; i++) {
+        if (old[i] == 0) continue;
+        size_t s = slotOf(m, m->order[old[i] - 1]);
+        while (m->slot[s] != 0) s = (s + 1) & (m->capacity - 1);
+        m->slot[s] = old[i];
+    }
+    free(old);
+}
+
+static inline void mapPrefetch(const CloneMap* m, const struct Node* p) {
+    if (m->dense) __builtin_prefetch(p);
+    else __builtin_prefetch(&m->slot[slotOf(m, p)]);
+}
+
+/* Index of p if present; otherwise maps p to index and returns -1. The
+   caller has already stored p at order[index]. */
+static inline int mapFindOrInsert(CloneMap* m, struct Node* p, int index) {
+    if (m->dense) {
+        if (m->dense[p->val]) return m->dense[p->val] - 1;
+        m->dense[p->val] = index + 1;
+        return -1;
+    }
+    size_t s = slotOf(m, p);
+    while (m->slot[s] != 0) {
+        if (m->order[m->slot[s] - 1] == p) return m->slot[s] - 1;
+        s = (s + 1) & (m->capacity - 1);
+    }
+    m->slot[s] = index + 1;
+    if (++m->size * 4 > m->capacity * 3) mapRehash(m);
+    return -1;
+}
+
+static struct Node* cloneWith(struct Node* s, CloneMap* m) {
+    // Pass 1: BFS order doubles as the queue. Each neighbor slot's clone
+    // index is recorded as it is looked up, so pass 2 never touches the
+    // map or the neighbors of the original again.
+    int capacity = 1024, count = 0;
+    long long targetCapacity = 4096, slots = 0;
+    struct Node** order = (struct Node**)malloc(capacity * sizeof(struct Node*));
+    int* target = (int*)malloc(targetCapacity * sizeof(int));
+    m->order = order;
+    order[count] = s;
+    mapFindOrInsert(m, s, count++);
+    for (int i = 0; i < count; i++) {
+        struct Node* cur = order[i];
+        if (slots + cur->numNeighbors > targetCapacity) {
+            while (slots + cur->numNeighbors > targetCapacity) targetCapacity *= 2;
+            target = (int*)realloc(target, targetCapacity * sizeof(int));
+        }
+        // Issue the map loads for the whole neighbor list before probing,
+        // so the misses overlap instead of queueing one after another.
+        for (int j = 0; j < cur->numNeighbors; j++) mapPrefetch(m, cur->neighbors[j]);
+        for (int j = 0; j < cur->numNeighbors; j++) {
+            if (count == capacity) {
+                capacity *= 2;
+                order = (struct Node**)realloc(order, capacity * sizeof(struct Node*));
+                m->order = order;
+            }
+            // Written before the lookup; it only counts if nb is new.
+            struct Node* nb = cur->neighbors[j];
+            order[count] = nb;
+            int index = mapFindOrInsert(m, nb, count);
+            if (index < 0) index = count++;
+            target[slots++] = index;
+        }
+    }
+
+    // Pass 2: nodes, then neighbor pointers, in one slab.
+    struct Node* clone = (struct Node*)malloc(count * sizeof(struct Node) + slots * sizeof(struct Node*));
+    struct Node** next = (struct Node**)(clone + count);
+    const int* t = target;
+    for (int i = 0; i < count; i++) {
+        int degree = order[i]->numNeighbors;
+        clone[i].val = order[i]->val;
+        clone[i].numNeighbors = degree;
+        clone[i].neighbors = next;
+        for (int j = 0; j < degree; j++) next[j] = &clone[t[j]];
+        next += degree;
+        t += degree;
+    }
+    free(order);
+    free(target);
+    return clone;
+}
+
+struct Node* cloneGraphSlab(struct Node* s) {
+    if (s == NULL) return NULL;
+    CloneMap m = { NULL, 0, 0, 0, NULL, NULL };
+    mapAllocate(&m, 1024);
+    struct Node* clone = cloneWith(s, &m);
+    free(m.slot);
+    return clone;
+}
+
+struct Node* cloneGraphDense(struct Node* s, int maxVal) {
+    if (s == NULL) return NULL;
+    CloneMap m = { NULL, 0, 0, 0, NULL, NULL };
+    m.dense = (int*)calloc((size_t)maxVal + 1, sizeof(int));
+    struct Node* clone = cloneWith(s, &m);
+    free(m.dense);
+    return clone;
+}
+
+struct Node* cloneGraph(struct Node* s) {
+    return cloneGraphSlab(s);
+}
@@ -0,0 +1,39 @@
+#ifndef GRAPH_CLONE_H
+#define GRAPH_CLONE_H
+
+/* LeetCode 133's node; see "Code description.me.txt". */
+struct Node {
+    int val;
+    int numNeighbors;
+    struct Node** neighbors;
+};
+
+/*
+   Graph cloning for large graphs with arbitrary ids.
+
+   Two passes over the component of s:
+   1. BFS that numbers every node (the clone of s is number 0), counts
+      the neighbor slots and records each slot's target number.
+   2. One allocation holding all cloned nodes followed by all neighbor
+      pointers, filled in BFS order from the recorded numbers; node i's
+      neighbors are a contiguous run of the pointer array.
+
+   The original-to-clone mapping is an open-addressing hash map keyed by
+   node address, so values may be anything, repeated or not. When values
+   are known to be distinct and in [0, maxVal], cloneGraphDense maps
+   them through a flat array instead.
+
+   The result is the clone of s at the start of the slab: free(clone)
+   releases the whole cloned graph. Neighbor order is preserved.
+   Scratch memory (BFS order, slot targets and the map) is freed before
+   returning; it grows by doubling, so a clone costs O(log V) allocations
+   instead of 2V.
+*/
+
+struct Node* cloneGraphSlab(struct Node* s);
+struct Node* cloneGraphDense(struct Node* s, int maxVal);
+
+/* LeetCode entry point; same as cloneGraphSlab. */
+struct Node* cloneGraph(struct Node* s);
+
+#endif
@@ -0,0 +1,52 @@
+#include <stdlib.h>
+#include "CSRGraph.h"
+
+CSRGraph* csrBuild(int n, int** edges, int edgesSize, int flags) {
+    int directed = flags & CSR_DIRECTED;
+    int weighted = flags & CSR_WEIGHTED;
+    int arcs = directed ? edgesSize : 2 * edgesSize;
+
+    size_t bytes = sizeof(CSRGraph)
+                 + (size_t)(n + 1) * sizeof(int)
+                 + (size_t)arcs * sizeof(int) * (weighted ? 2 : 1);
+    CSRGraph* g = (CSRGraph*)malloc(bytes);
+    if (g == NULL) return NULL;
+
+    g->n = n;
+    g->arcs = arcs;
+    g->offset = (int*)(g + 1);
+    g->adj = g->offset + (n + 1);
+    g->weight = weighted ? g->adj + arcs : NULL;
+
+    // Pass 1: out-degree of v goes to offset[v + 1], then prefix sums.
+    for (int v = 0; v <= n; v++) g->offset[v] = 0;
+    for (int i = 0; i < edgesSize; i++) {
+        g->offset[edges[i][0] + 1]++;
+        if (!directed) g->offset[edges[i][1] + 1]++;
+    }
+    for (int v = 0; v < n; v++) g->offset[v + 1] += g->offset[v];
+
+    // Pass 2: offset[v] doubles as the fill cursor of v ...
+    int* cur = g->offset;
+    for (int i = 0; i < edgesSize; i++) {
+        int u = edges[i][0], v = edges[i][1];
+        int w = weighted ? edges[i][2] : 0;
+        int p = cur[u]++;
+        g->adj[p] = v;
+        if (weighted) g->weight[p] = w;
+        if (!directed) {
+            p = cur[v]++;
+            g->adj[p] = u;
+            if (weighted) g->weight[p] = w;
+        }
+    }
+    // ... which leaves offset[v] == start of v + 1, so shift back by one.
+    for (int v = n; v > 0; v--) g->offset[v] = g->offset[v - 1];
+    g->offset[0] = 0;
+
+    return g;
+}
+
+void csrFree(CSRGraph* g) {
+    free(g);
+}
@@ -0,0 +1,35 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+/*
+   Immutable compressed-sparse-row graph built from a LeetCode edge list
+   (int** edges, each row [u, v] or [u, v, w]).
+
+   The arcs leaving v are adj[offset[v] .. offset[v+1]), in edge-list
+   order, with their weights at the same positions in weight[].
+   An undirected edge is stored as two arcs (one per endpoint).
+
+   The struct, offsets, neighbours and weights live in one allocation,
+   built in two counting passes; csrFree releases all of it.
+*/
+
+#define CSR_UNDIRECTED 0
+#define CSR_DIRECTED   1    // only u -> v
+#define CSR_WEIGHTED   2    // read edges[i][2] into weight[]
+
+typedef struct {
+    int n;          // vertices 0 .. n-1
+    int arcs;       // number of stored arcs
+    int* offset;    // n + 1 entries
+    int* adj;       // arcs entries
+    int* weight;    // arcs entries, NULL unless CSR_WEIGHTED
+} CSRGraph;
+
+CSRGraph* csrBuild(int n, int** edges, int edgesSize, int flags);
+void csrFree(CSRGraph* g);
+
+static inline int csrDegree(const CSRGraph* g, int v) {
+    return g->offset[v + 1] - g->offset[v];
+}
+
+#endif
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "CSRGraph.h"
+
+/*
+   CSRGraph against per-vertex realloc'd adjacency lists (the Vec/vecPush
+   scheme of 3108/O1.c).
+
+   Build:  gcc -O2 CSRGraphBenchmark.c CSRGraph.c -o csrbench
+   Run:    ./csrbench [n] [edges]
+
+   "build" turns a weighted undirected edge list into adjacency;
+   "sweep" reads every (neighbour, weight) pair once, in vertex order;
+   "bfs" runs one breadth-first search from vertex 0.
+*/
+
+typedef struct {
+    int to;
+    int w;
+} Edge;
+
+typedef struct {
+    Edge* data;
+    int size;
+    int capacity;
+} Vec;
+
+static void vecInit(Vec* vec, int cap) {
+    vec->data = (Edge*)malloc(cap * sizeof(Edge));
+    vec->size = 0;
+    vec->capacity = cap;
+}
+
+static void vecPush(Vec* vec, int to, int w) {
+    if (vec->size == vec->capacity) {
+        vec->capacity *= 2;
+        vec->data = (Edge*)realloc(vec->data, vec->capacity * sizeof(Edge));
+    }
+    vec->data[vec->size].to = to;
+    vec->data[vec->size].w = w;
+    vec->size++;
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int m = (argc > 2) ? atoi(argv[2]) : 4000000;
+
+    srand(28);
+    int** edges = (int**)malloc(m * sizeof(int*));
+    int* rows = (int*)malloc((size_t)m * 3 * sizeof(int));
+    for (int i = 0; i < m; i++) {
+        edges[i] = rows + (size_t)i * 3;
+        edges[i][0] = rand() % n;
+        edges[i][1] = rand() % n;
+        edges[i][2] = rand() % 1000;
+    }
+    int* queue = (int*)malloc(n * sizeof(int));
+    char* seen = (char*)malloc(n);
+    double arcBytes = 2.0 * m * 2 * sizeof(int);
+
+    /* ---- Vec lists ---- */
+    double t0 = nowSeconds();
+    Vec* adj = (Vec*)malloc(n * sizeof(Vec));
+    for (int i = 0; i < n; i++) vecInit(&adj[i], 2);
+    for (int i = 0; i < m; i++) {
+        vecPush(&adj[edges[i][0]], edges[i][1], edges[i][2]);
+        vecPush(&adj[edges[i][1]], edges[i][0], edges[i][2]);
+    }
+    double vecBuild = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    long long vecSum = 0;
+    for (int v = 0; v < n; v++) {
+        for (int i = 0; i < adj[v].size; i++) vecSum += adj[v].data[i].to + adj[v].data[i].w;
+    }
+    double vecSweep = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (int v = 0; v < n; v++) seen[v] = 0;
+    int front = 0, rear = 0, vecReached;
+    queue[rear++] = 0;
+    seen[0] = 1;
+    while (front < rear) {
+        int u = queue[front++];
+        for (int i = 0; i < adj[u].size; i++) {
+            int v = adj[u].data[i].to;
+            if (!seen[v]) { seen[v] = 1; queue[rear++] = v; }
+        }
+    }
+    vecReached = rear;
+    double vecBfs = nowSeconds() - t0;
+
+    for (int i = 0; i < n; i++) free(adj[i].data);
+    free(adj);
+
+    /* ---- CSR ---- */
+    t0 = nowSeconds();
+    CSRGraph* g = csrBuild(n, edges, m, CSR_UNDIRECTED | CSR_WEIGHTED);
+    double csrBuildTime = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    long long csrSum = 0;
+    for (int i = 0; i < g->arcs; i++) csrSum += g->adj[i] + g->weight[i];
+    double csrSweep = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (int v = 0; v < n; v++) seen[v] = 0;
+    front = 0; rear = 0;
+    queue[rear++] = 0;
+    seen[0] = 1;
+    while (front < rear) {
+        int u = queue[front++];
+        for (int i = g->offset[u]; i < g->offset[u + 1]; i++) {
+            int v = g->adj[i];
+            if (!seen[v]) { seen[v] = 1; queue[rear++] = v; }
+        }
+    }
+    double csrBfs = nowSeconds() - t0;
+
+    printf("n = %d, edges = %d (%d arcs)\n", n, m, 2 * m);
+    printf("%-6s %10s %12s %10s\n", "", "build ms", "sweep GB/s", "bfs ms");
+    printf("%-6s %10.1f %12.2f %10.1f\n", "Vec", vecBuild * 1e3, arcBytes / vecSweep / 1e9, vecBfs * 1e3);
+    printf("%-6s %10.1f %12.2f %10.1f\n", "CSR", csrBuildTime * 1e3, arcBytes / csrSweep / 1e9, csrBfs * 1e3);
+    if (vecSum != csrSum || vecReached != rear) printf("MISMATCH between representations\n");
+
+    csrFree(g);
+    free(queue);
+    free(seen);
+    free(rows);
+    free(edges);
+    return 0;
+}
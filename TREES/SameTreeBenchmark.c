@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "TreePool.h"
+
+/*
+   TreePool's subtree comparison, dedup and incremental hashes against
+   the original recursive isSameTree of 100 (Same Tree).
+
+   Build:  gcc -O2 SameTreeBenchmark.c TreePool.c -o samebench
+   Run:    ./samebench [rounds] [nodes]
+
+   Each round grafts random small trees with values in {0, 1, 2} into one
+   forest, so equal subtrees are common, then:
+   - compares random subtree pairs with the recursive reference,
+     treePoolSubtreeEqual, treePoolSameSubtree and 100's isSameTree;
+   - checks treePoolDedup against a brute-force search for the smallest
+     identical subtree;
+   - applies random treePoolSetValue / treePoolSetChildren / treePoolAdd /
+     treePoolGraft changes and checks that the incrementally updated
+     hashes equal a full recompute after treePoolInvalidate.
+   The timing part changes one value of a `nodes`-node tree (default
+   10^6) and compares it with a copy that differs in its last node, with
+   the incremental update and with a full invalidate. The hashes differ,
+   so each query costs what the update costs.
+*/
+
+#include "../100 (Same Tree)/main.c"
+
+/* The original recursive comparison. */
+static void preOrder(struct TreeNode* p, struct TreeNode* q, int* flag) {
+    if (p == NULL && q == NULL) return;
+    if (p == NULL || q == NULL) {
+        *flag = 0;
+        return;
+    }
+    if (p->val != q->val) *flag = 0;
+    preOrder(p->left, q->left, flag);
+    preOrder(p->right, q->right, flag);
+}
+
+static bool isSameTreeRecursive(struct TreeNode* p, struct TreeNode* q) {
+    int flag = 1;
+    preOrder(p, q, &flag);
+    return flag == 1;
+}
+
+/* Random level-order tree of n nodes, values in {0, 1, 2}. */
+static TreePool* randomTree(int n) {
+    char* text = (char*)malloc((size_t)n * 8 + 16);
+    size_t len = 0;
+    text[len++] = '[';
+    len += sprintf(text + len, "%d", rand() % 3);
+    int created = 1;
+    for (int parent = 0; parent < created && created < n; parent++) {
+        for (int side = 0; side < 2 && created < n; side++) {
+            // Never let the tree die out before it reaches n nodes.
+            if (rand() % 3 != 0 || (side == 1 && parent == created - 1)) {
+                len += sprintf(text + len, ",%d", rand() % 3);
+                created++;
+            } else {
+                len += sprintf(text + len, ",null");
+            }
+        }
+    }
+    text[len++] = ']';
+    text[len] = '\0';
+    TreePool* t = treeDeserialize(text);
+    free(text);
+    return t;
+}
+
+static struct TreeNode* nodeAt(struct TreeNode* nodes, int i) {
+    return (i == TREE_NULL) ? NULL : &nodes[i];
+}
+
+/* Pairs and dedup on the current forest; returns the number of wrong
+   answers. */
+static int checkForest(TreePool* f, int pairs) {
+    struct TreeNode* nodes = treePoolToNodes(f);
+    int bad = 0;
+    for (int p = 0; p < pairs; p++) {
+        int i = rand() % (f->n + 1) - 1;
+        int j = rand() % (f->n + 1) - 1;
+        bool expected = isSameTreeRecursive(nodeAt(nodes, i), nodeAt(nodes, j));
+        bad += (treePoolSubtreeEqual(f, i, f, j) != expected);
+        bad += (treePoolSameSubtree(f, i, f, j) != expected);
+        bad += (isSameTree(nodeAt(nodes, i), nodeAt(nodes, j)) != expected);
+    }
+
+    int* canonical = (int*)malloc(f->n * sizeof(int));
+    int distinct = treePoolDedup(f, canonical), expectedDistinct = 0;
+    for (int i = 0; i < f->n; i++) {
+        int first = i;
+        for (int j = 0; j < i; j++) {
+            if (isSameTreeRecursive(&nodes[i], &nodes[j])) {
+                first = j;
+                break;
+            }
+        }
+        expectedDistinct += (first == i);
+        bad += (canonical[i] != first);
+    }
+    bad += (distinct != expectedDistinct);
+    free(canonical);
+    free(nodes);
+    return bad;
+}
+
+/* Incremental hashes against a full recompute. */
+static int checkHashes(TreePool* f) {
+    uint64_t* incremental = (uint64_t*)malloc(f->n * sizeof(uint64_t));
+    memcpy(incremental, treePoolHashes(f), f->n * sizeof(uint64_t));
+    treePoolInvalidate(f);
+    int bad = memcmp(incremental, treePoolHashes(f), f->n * sizeof(uint64_t)) != 0;
+    free(incremental);
+    return bad;
+}
+
+static void mutate(TreePool* f) {
+    int i = rand() % f->n;
+    switch (rand() % 4) {
+    case 0:
+        treePoolSetValue(f, i, rand() % 3);
+        break;
+    case 1: {
+        // Any later node may become a child, shared or not.
+        int left = (i + 1 < f->n && rand() % 2) ? i + 1 + rand() % (f->n - i - 1) : TREE_NULL;
+        int right = (i + 1 < f->n && rand() % 2) ? i + 1 + rand() % (f->n - i - 1) : TREE_NULL;
+        treePoolSetChildren(f, i, left, right);
+        break;
+    }
+    case 2:
+        treePoolAdd(f, rand() % 3);
+        break;
+    default: {
+        TreePool* g = randomTree(1 + rand() % 8);
+        treePoolGraft(f, g);
+        treePoolFree(g);
+    }
+    }
+}
+
+int main(int argc, char** argv) {
+    int rounds = (argc > 1) ? atoi(argv[1]) : 200;
+    int n = (argc > 2) ? atoi(argv[2]) : 1000000;
+    srand(100);
+
+    int bad = 0, checks = 0;
+    for (int r = 0; r < rounds; r++) {
+        TreePool* f = treePoolCreate(16);
+        int trees = 1 + rand() % 20;
+        for (int k = 0; k < trees; k++) {
+            TreePool* g = randomTree(1 + rand() % 12);
+            treePoolGraft(f, g);
+            treePoolFree(g);
+        }
+        bad += checkForest(f, 200);
+        treePoolHashes(f);
+        for (int step = 0; step < 20; step++) {
+            for (int m = rand() % 4; m >= 0; m--) mutate(f);
+            bad += checkHashes(f);
+            checks++;
+        }
+        bad += checkForest(f, 200);
+        treePoolFree(f);
+    }
+    printf("%d rounds, %d hash checks: %d wrong%s\n", rounds, checks, bad, bad ? "  (MISMATCH)" : "");
+
+    // One change, then one comparison of the root with the altered copy.
+    TreePool* big = randomTree(n);
+    int copy = treePoolGraft(big, big);
+    treePoolSetValue(big, big->n - 1, big->val[big->n - 1] + 1);
+    treePoolHashes(big);
+    printf("\n%d-node tree against an altered copy\n", big->n / 2);
+    printf("%-12s %12s %6s\n", "update", "ms per query", "same");
+    for (int full = 0; full < 2; full++) {
+        int queries = 100;
+        bool same = false;
+        double t0 = nowSeconds();
+        for (int q = 0; q < queries; q++) {
+            int i = rand() % (big->n / 2);
+            treePoolSetValue(big, i, big->val[i]);
+            if (full) treePoolInvalidate(big);
+            same = treePoolSameSubtree(big, 0, big, copy);
+        }
+        double t = (nowSeconds() - t0) / queries;
+        printf("%-12s %12.3f %6s\n", full ? "full" : "incremental", t * 1e3, same ? "yes" : "no");
+    }
+    treePoolFree(big);
+    return 0;
+}
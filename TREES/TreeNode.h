@@ -0,0 +1,11 @@
+#ifndef TREE_NODE_H
+#define TREE_NODE_H
+
+/* LeetCode's pointer-based binary tree node, shared by the tree solutions. */
+struct TreeNode {
+    int val;
+    struct TreeNode *left;
+    struct TreeNode *right;
+};
+
+#endif
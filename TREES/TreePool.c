@@ -0,0 +1,336 @@
+#include <stdlib.h>
+#include <string.h>
+#include "TreePool.h"
+
+/* Moves the three arrays into one slab of the given capacity. */
+static void treePoolResize(TreePool* t, int capacity) {
+    char* slab = (char*)malloc((size_t)capacity * (sizeof(int) + 2 * sizeof(int32_t)));
+    int* val = (int*)slab;
+    int32_t* left = (int32_t*)(val + capacity);
+    int32_t* right = left + capacity;
+    if (t->n > 0) {
+        memcpy(val, t->val, t->n * sizeof(int));
+        memcpy(left, t->left, t->n * sizeof(int32_t));
+        memcpy(right, t->right, t->n * sizeof(int32_t));
+    }
+    free(t->val);
+    t->val = val;
+    t->left = left;
+    t->right = right;
+    t->capacity = capacity;
+    if (t->hash) t->hash = (uint64_t*)realloc(t->hash, (size_t)capacity * sizeof(uint64_t));
+}
+
+/* Node i changed: its hash and its ancestors' (all at smaller indices)
+   are stale. */
+static inline void markDirty(TreePool* t, int i) {
+    if (i < t->hashCount && i > t->hashDirty) t->hashDirty = i;
+}
+
+TreePool* treePoolCreate(int capacity) {
+    TreePool* t = (TreePool*)calloc(1, sizeof(TreePool));
+    t->hashDirty = -1;
+    treePoolResize(t, capacity > 0 ? capacity : 16);
+    return t;
+}
+
+void treePoolFree(TreePool* t) {
+    if (t == NULL) return;
+    free(t->val);
+    free(t->hash);
+    free(t);
+}
+
+int treePoolAdd(TreePool* t, int val) {
+    if (t->n == t->capacity) treePoolResize(t, t->capacity * 2);
+    int i = t->n++;
+    t->val[i] = val;
+    t->left[i] = TREE_NULL;
+    t->right[i] = TREE_NULL;
+    return i;
+}
+
+enum { TOKEN_VALUE, TOKEN_NULL, TOKEN_END, TOKEN_ERROR };
+
+/* Reads one element and the ',' or ']' after it. */
+static int readToken(const char** cursor, int* value) {
+    const char* p = *cursor;
+    while (*p == ' ') p++;
+    int kind;
+    if (*p == ']') {
+        *cursor = p;
+        return TOKEN_END;
+    }
+    if (p[0] == 'n' && p[1] == 'u' && p[2] == 'l' && p[3] == 'l') {
+        p += 4;
+        kind = TOKEN_NULL;
+    } else {
+        int negative = (*p == '-');
+        p += negative;
+        if (*p < '0' || *p > '9') return TOKEN_ERROR;
+        // v never exceeds 2^31 before the multiply, so it cannot overflow;
+        // anything outside int is malformed.
+        long long limit = negative ? 2147483648LL : 2147483647LL;
+        long long v = 0;
+        while (*p >= '0' && *p <= '9') {
+            v = v * 10 + (*p++ - '0');
+            if (v > limit) return TOKEN_ERROR;
+        }
+        *value = (int)(negative ? -v : v);
+        kind = TOKEN_VALUE;
+    }
+    while (*p == ' ') p++;
+    if (*p == ',') p++;
+    else if (*p != ']') return TOKEN_ERROR;
+    *cursor = p;
+    return kind;
+}
+
+TreePool* treeDeserialize(const char* text) {
+    const char* p = text;
+    while (*p == ' ') p++;
+    if (*p++ != '[') return NULL;
+
+    // Every node is one element, so the commas bound the node count.
+    int elements = 1;
+    for (const char* c = p; *c && *c != ']'; c++) elements += (*c == ',');
+    TreePool* t = treePoolCreate(elements);
+
+    int value;
+    int kind = readToken(&p, &value);
+    if (kind == TOKEN_VALUE) {
+        treePoolAdd(t, value);
+        // Nodes are created in BFS order, so the parent of the next two
+        // elements is simply the next node in index order.
+        for (int parent = 0; parent < t->n && kind != TOKEN_END; parent++) {
+            for (int side = 0; side < 2; side++) {
+                kind = readToken(&p, &value);
+                if (kind == TOKEN_END) break;
+                if (kind == TOKEN_ERROR) {
+                    treePoolFree(t);
+                    return NULL;
+                }
+                if (kind == TOKEN_VALUE) {
+                    int child = treePoolAdd(t, value);
+                    if (side == 0) t->left[parent] = child;
+                    else t->right[parent] = child;
+                }
+            }
+        }
+    }
+    // Only trailing nulls may follow the last node.
+    while (kind == TOKEN_NULL) kind = readToken(&p, &value);
+    if (kind != TOKEN_END) {
+        treePoolFree(t);
+        return NULL;
+    }
+    return t;
+}
+
+TreePool* treePoolFromNodes(const struct TreeNode* root) {
+    TreePool* t = treePoolCreate(64);
+    if (root == NULL) return t;
+
+    // source[i] is the pointer node that became pool node i.
+    int sourceCapacity = 64;
+    const struct TreeNode** source = (const struct TreeNode**)malloc(sourceCapacity * sizeof(*source));
+    source[treePoolAdd(t, root->val)] = root;
+    for (int i = 0; i < t->n; i++) {
+        const struct TreeNode* kids[2] = { source[i]->left, source[i]->right };
+        for (int side = 0; side < 2; side++) {
+            if (kids[side] == NULL) continue;
+            int child = treePoolAdd(t, kids[side]->val);
+            if (child == sourceCapacity) {
+                sourceCapacity *= 2;
+                source = (const struct TreeNode**)realloc(source, sourceCapacity * sizeof(*source));
+            }
+            source[child] = kids[side];
+            if (side == 0) t->left[i] = child;
+            else t->right[i] = child;
+        }
+    }
+    free(source);
+    return t;
+}
+
+struct TreeNode* treePoolToNodes(const TreePool* t) {
+    if (t->n == 0) return NULL;
+    struct TreeNode* nodes = (struct TreeNode*)malloc(t->n * sizeof(struct TreeNode));
+    for (int i = 0; i < t->n; i++) {
+        nodes[i].val = t->val[i];
+        nodes[i].left = (t->left[i] == TREE_NULL) ? NULL : &nodes[t->left[i]];
+        nodes[i].right = (t->right[i] == TREE_NULL) ? NULL : &nodes[t->right[i]];
+    }
+    return nodes;
+}
+
+int treePoolMaxDepth(const TreePool* t) {
+    // Level [begin, end) has as many children as the next level has nodes.
+    int depth = 0;
+    for (int begin = 0, end = (t->n > 0); begin < end; depth++) {
+        int children = 0;
+        for (int i = begin; i < end; i++) {
+            children += (t->left[i] != TREE_NULL) + (t->right[i] != TREE_NULL);
+        }
+        begin = end;
+        end += children;
+    }
+    return depth;
+}
+
+int treePoolGraft(TreePool* dst, const TreePool* src) {
+    if (src->n == 0) return TREE_NULL;
+    int offset = dst->n;
+    if (dst->n + src->n > dst->capacity) {
+        int capacity = dst->capacity;
+        while (capacity < dst->n + src->n) capacity *= 2;
+        treePoolResize(dst, capacity);
+    }
+    memcpy(dst->val + offset, src->val, src->n * sizeof(int));
+    for (int i = 0; i < src->n; i++) {
+        dst->left[offset + i] = (src->left[i] == TREE_NULL) ? TREE_NULL : src->left[i] + offset;
+        dst->right[offset + i] = (src->right[i] == TREE_NULL) ? TREE_NULL : src->right[i] + offset;
+    }
+    dst->n += src->n;
+    return offset;
+}
+
+void treePoolSetValue(TreePool* t, int i, int val) {
+    t->val[i] = val;
+    markDirty(t, i);
+}
+
+int treePoolSetChildren(TreePool* t, int i, int left, int right) {
+    if ((left != TREE_NULL && left <= i) || (right != TREE_NULL && right <= i)) return 0;
+    t->left[i] = left;
+    t->right[i] = right;
+    markDirty(t, i);
+    return 1;
+}
+
+void treePoolInvalidate(TreePool* t) {
+    t->hashCount = 0;
+    t->hashDirty = -1;
+}
+
+#define EMPTY_HASH 0x9E3779B97F4A7C15ULL
+
+static inline uint64_t mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static inline uint64_t childHash(const TreePool* t, int c) {
+    return (c == TREE_NULL) ? EMPTY_HASH : t->hash[c];
+}
+
+/* Left and right go through different mixing depths, so mirrored
+   subtrees hash differently. */
+static inline void hashNode(TreePool* t, int i) {
+    uint64_t h = mix64((uint64_t)(uint32_t)t->val[i] ^ mix64(childHash(t, t->left[i])));
+    t->hash[i] = mix64(h ^ childHash(t, t->right[i]));
+}
+
+const uint64_t* treePoolHashes(TreePool* t) {
+    if (t->hash == NULL) t->hash = (uint64_t*)malloc((size_t)t->capacity * sizeof(uint64_t));
+    // Children have larger indices, so walking down finishes them first.
+    // Appended nodes only have appended children, so they go first; then
+    // the stale prefix, whose children are either in it, already valid,
+    // or appended.
+    for (int i = t->n - 1; i >= t->hashCount; i--) hashNode(t, i);
+    for (int i = t->hashDirty; i >= 0; i--) hashNode(t, i);
+    t->hashCount = t->n;
+    t->hashDirty = -1;
+    return t->hash;
+}
+
+bool treePoolSubtreeEqual(const TreePool* a, int i, const TreePool* b, int j) {
+    int local[2 * 64];
+    int* stack = local;
+    int capacity = 64, top = 0;
+    bool same = true;
+
+    stack[top++] = i;
+    stack[top++] = j;
+    while (top > 0) {
+        int y = stack[--top];
+        int x = stack[--top];
+        if (x == TREE_NULL || y == TREE_NULL) {
+            if (x != y) {
+                same = false;
+                break;
+            }
+            continue;
+        }
+        if (a == b && x == y) continue;
+        if (a->val[x] != b->val[y]) {
+            same = false;
+            break;
+        }
+        if (top + 4 > 2 * capacity) {
+            capacity *= 2;
+            int* grown = (int*)malloc(2 * capacity * sizeof(int));
+            memcpy(grown, stack, top * sizeof(int));
+            if (stack != local) free(stack);
+            stack = grown;
+        }
+        stack[top++] = a->right[x];
+        stack[top++] = b->right[y];
+        stack[top++] = a->left[x];
+        stack[top++] = b->left[y];
+    }
+    if (stack != local) free(stack);
+    return same;
+}
+
+bool treePoolSameSubtree(TreePool* a, int i, TreePool* b, int j) {
+    if (i == TREE_NULL || j == TREE_NULL) return i == j;
+    if (a == b && i == j) return true;
+    if (treePoolHashes(a)[i] != treePoolHashes(b)[j]) return false;
+    return treePoolSubtreeEqual(a, i, b, j);
+}
+
+int treePoolDedup(TreePool* t, int* canonical) {
+    const uint64_t* hash = treePoolHashes(t);
+    int size = 16;
+    while (size < 2 * t->n) size *= 2;
+    int* table = (int*)malloc(size * sizeof(int));
+    int* smallest = (int*)malloc((t->n > 0 ? t->n : 1) * sizeof(int));
+    memset(table, 0xFF, size * sizeof(int));
+
+    // Bottom-up, canonical[] first holds the first member found of each
+    // class. Two subtrees are identical iff their values match and their
+    // children are in the same classes, so a probe compares three ints.
+    int distinct = 0;
+    for (int i = t->n - 1; i >= 0; i--) {
+        int l = (t->left[i] == TREE_NULL) ? TREE_NULL : canonical[t->left[i]];
+        int r = (t->right[i] == TREE_NULL) ? TREE_NULL : canonical[t->right[i]];
+        size_t slot = hash[i] & (size - 1);
+        for (;; slot = (slot + 1) & (size - 1)) {
+            int j = table[slot];
+            if (j < 0) {
+                table[slot] = i;
+                canonical[i] = i;
+                distinct++;
+                break;
+            }
+            int lj = (t->left[j] == TREE_NULL) ? TREE_NULL : canonical[t->left[j]];
+            int rj = (t->right[j] == TREE_NULL) ? TREE_NULL : canonical[t->right[j]];
+            if (hash[j] == hash[i] && t->val[j] == t->val[i] && lj == l && rj == r) {
+                canonical[i] = j;
+                break;
+            }
+        }
+        // Indices only go down, so the last member seen is the smallest.
+        smallest[canonical[i]] = i;
+    }
+    for (int i = 0; i < t->n; i++) canonical[i] = smallest[canonical[i]];
+
+    free(table);
+    free(smallest);
+    return distinct;
+}
@@ -0,0 +1,96 @@
+#ifndef TREE_POOL_H
+#define TREE_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "TreeNode.h"
+
+/*
+   Binary tree stored structure-of-arrays in one slab: node i has value
+   val[i] and children left[i], right[i] (32-bit indices, TREE_NULL when
+   absent). Node 0 is the root.
+
+   Trees built by treeDeserialize and treePoolFromNodes are in BFS order:
+   nodes are numbered level by level, left to right, so each level is a
+   contiguous index range and children come after their parent. Whole-tree
+   passes then become linear scans of three arrays instead of pointer
+   chasing. treePoolAdd appends in any order; the functions that rely on
+   BFS order say so.
+
+   Every builder keeps children at larger indices than their parents, so
+   subtrees can be processed bottom-up by walking indices downwards. A
+   pool may hold several trees (a forest), e.g. through treePoolGraft.
+
+   Subtree hashes are Merkle-style: a node's hash mixes its value with
+   its children's hashes, so equal subtrees hash equally wherever they
+   sit, in any pool. They are computed on first use and then kept up to
+   date lazily. A change at node i can only affect i and its ancestors,
+   which all have smaller indices, so the next hash query recomputes
+   nodes i, i - 1, ..., 0: O(i), up to O(n) for a change near the end
+   of the pool. Appended nodes are hashed on their own. After writing
+   val/left/right directly, call treePoolInvalidate, which makes the next
+   query recompute all n.
+*/
+
+#define TREE_NULL (-1)
+
+typedef struct {
+    int n;              // nodes 0 .. n-1
+    int capacity;
+    int* val;
+    int32_t* left;
+    int32_t* right;
+    uint64_t* hash;     // subtree hashes, capacity entries
+    int hashCount;      // nodes [0, hashCount) had a hash computed
+    int hashDirty;      // largest of those that is stale, -1 if none
+} TreePool;
+
+TreePool* treePoolCreate(int capacity);
+void treePoolFree(TreePool* t);
+
+/* Appends a childless node and returns its index. */
+int treePoolAdd(TreePool* t, int val);
+
+/* Parses LeetCode's level-order format, e.g. "[1,2,null,3]"; "[]" is the
+   empty tree. Returns NULL on malformed input, including values outside
+   the range of int. */
+TreePool* treeDeserialize(const char* text);
+
+/* Relabels a pointer tree into BFS order; NULL gives an empty pool. */
+TreePool* treePoolFromNodes(const struct TreeNode* root);
+
+/* Builds a pointer tree for the TreeNode* APIs. Node i of the pool is
+   element i of one array, so the root is NULL for an empty pool and
+   free(root) releases the whole tree. */
+struct TreeNode* treePoolToNodes(const TreePool* t);
+
+/* Copies src into dst as another tree of the forest; returns the index
+   of its root in dst, or TREE_NULL if src is empty. */
+int treePoolGraft(TreePool* dst, const TreePool* src);
+
+/* Changes that keep the hashes honest. treePoolSetChildren refuses (and
+   returns 0) a child index that is not larger than i. */
+void treePoolSetValue(TreePool* t, int i, int val);
+int treePoolSetChildren(TreePool* t, int i, int left, int right);
+void treePoolInvalidate(TreePool* t);
+
+/* hash[i] for every node, computing them bottom-up if needed. */
+const uint64_t* treePoolHashes(TreePool* t);
+
+/* Whether subtree i of a and subtree j of b are identical. The first
+   walks both with an explicit stack and stops at the first difference;
+   the second rejects unequal hashes in O(1) and walks only when the
+   hashes agree. Either index may be TREE_NULL (the empty tree). */
+bool treePoolSubtreeEqual(const TreePool* a, int i, const TreePool* b, int j);
+bool treePoolSameSubtree(TreePool* a, int i, TreePool* b, int j);
+
+/* Hash-consing: canonical[i] is the smallest index whose subtree is
+   identical to subtree i. Returns the number of distinct subtrees. Exact;
+   hash collisions are resolved by comparing values and canonical
+   children. */
+int treePoolDedup(TreePool* t, int* canonical);
+
+/* Number of levels, counted one level range at a time. BFS order only. */
+int treePoolMaxDepth(const TreePool* t);
+
+#endif
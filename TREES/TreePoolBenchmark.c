@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../BENCH/BenchUtil.h"
+#include "TreePool.h"
+
+/*
+   TreePool against pointer trees on a random tree.
+
+   Build:  gcc -O2 TreePoolBenchmark.c TreePool.c -o treebench
+   Run:    ./treebench [nodes]
+
+   The tree (default 10^7 nodes) is generated as LeetCode text, each
+   child present with probability 3/4. "malloc tree" has one malloc per
+   node in BFS order, like newNode in 104/main.c; "adapter tree" is
+   treePoolToNodes, one array. The traversals are maxDepth (recursive, as
+   in 104, against treePoolMaxDepth) and the sum of all values (recursive
+   walk against a scan of val[]).
+*/
+
+/* Level-order text for a random tree of n nodes. */
+static char* randomTreeText(int n, size_t* length) {
+    size_t capacity = (size_t)n * 24 + 16;
+    char* text = (char*)malloc(capacity);
+    size_t len = 0;
+    text[len++] = '[';
+    len += sprintf(text + len, "%d", rand() % 2001 - 1000);
+    int created = 1;
+    for (int parent = 0; parent < created && created < n; parent++) {
+        for (int side = 0; side < 2 && created < n; side++) {
+            // Never let the tree die out before it reaches n nodes.
+            int present = (rand() % 4 != 0) || (side == 1 && parent == created - 1);
+            if (present) {
+                len += sprintf(text + len, ",%d", rand() % 2001 - 1000);
+                created++;
+            } else {
+                len += sprintf(text + len, ",null");
+            }
+        }
+    }
+    text[len++] = ']';
+    text[len] = '\0';
+    *length = len;
+    return text;
+}
+
+static int maxDepth(const struct TreeNode* root) {
+    if (root == NULL) return 0;
+    int l = maxDepth(root->left);
+    int r = maxDepth(root->right);
+    return (l > r) ? (l + 1) : (r + 1);
+}
+
+static long long sumNodes(const struct TreeNode* root) {
+    if (root == NULL) return 0;
+    return root->val + sumNodes(root->left) + sumNodes(root->right);
+}
+
+static long long sumPool(const TreePool* t) {
+    long long sum = 0;
+    for (int i = 0; i < t->n; i++) sum += t->val[i];
+    return sum;
+}
+
+/* One malloc per node, allocated in BFS order. */
+static struct TreeNode* mallocTree(const TreePool* t, struct TreeNode** all) {
+    for (int i = 0; i < t->n; i++) all[i] = (struct TreeNode*)malloc(sizeof(struct TreeNode));
+    for (int i = 0; i < t->n; i++) {
+        all[i]->val = t->val[i];
+        all[i]->left = (t->left[i] == TREE_NULL) ? NULL : all[t->left[i]];
+        all[i]->right = (t->right[i] == TREE_NULL) ? NULL : all[t->right[i]];
+    }
+    return all[0];
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    srand(40);
+    size_t length;
+    char* text = randomTreeText(n, &length);
+
+    double t0 = nowSeconds();
+    TreePool* pool = treeDeserialize(text);
+    double tParse = nowSeconds() - t0;
+    printf("deserialize: %d nodes, %.1f MB of text, %.1f ms (%.0f MB/s)\n", pool->n,
+           length / 1048576.0, tParse * 1e3, length / tParse * 1e-6);
+
+    t0 = nowSeconds();
+    struct TreeNode* adapter = treePoolToNodes(pool);
+    printf("treePoolToNodes: %.1f ms\n", (nowSeconds() - t0) * 1e3);
+
+    t0 = nowSeconds();
+    TreePool* back = treePoolFromNodes(adapter);
+    double tBack = nowSeconds() - t0;
+    int bad = back->n != pool->n
+           || memcmp(back->val, pool->val, pool->n * sizeof(int)) != 0
+           || memcmp(back->left, pool->left, pool->n * sizeof(int32_t)) != 0
+           || memcmp(back->right, pool->right, pool->n * sizeof(int32_t)) != 0;
+    printf("treePoolFromNodes: %.1f ms%s\n", tBack * 1e3, bad ? "  (MISMATCH)" : "");
+    treePoolFree(back);
+
+    struct TreeNode** all = (struct TreeNode**)malloc(pool->n * sizeof(struct TreeNode*));
+    struct TreeNode* scattered = mallocTree(pool, all);
+
+    printf("\n%-14s %14s %14s\n", "layout", "maxDepth ms", "sum ms");
+    const char* names[2] = { "malloc tree", "adapter tree" };
+    struct TreeNode* roots[2] = { scattered, adapter };
+    int depth = treePoolMaxDepth(pool);
+    long long sum = sumPool(pool);
+    for (int k = 0; k < 2; k++) {
+        t0 = nowSeconds();
+        int d = maxDepth(roots[k]);
+        double tDepth = nowSeconds() - t0;
+        t0 = nowSeconds();
+        long long s = sumNodes(roots[k]);
+        double tSum = nowSeconds() - t0;
+        printf("%-14s %14.2f %14.2f%s\n", names[k], tDepth * 1e3, tSum * 1e3,
+               (d != depth || s != sum) ? "  (MISMATCH)" : "");
+    }
+    t0 = nowSeconds();
+    depth = treePoolMaxDepth(pool);
+    double tDepth = nowSeconds() - t0;
+    // Through a volatile pointer, or the compiler reuses the sum above.
+    long long (*volatile sumFunction)(const TreePool*) = sumPool;
+    t0 = nowSeconds();
+    sum = sumFunction(pool);
+    double tSum = nowSeconds() - t0;
+    printf("%-14s %14.2f %14.2f   (depth %d)\n", "TreePool", tDepth * 1e3, tSum * 1e3, depth);
+
+    for (int i = 0; i < pool->n; i++) free(all[i]);
+    free(all);
+    free(adapter);
+    treePoolFree(pool);
+    free(text);
+    return 0;
+}